@@ -5,14 +5,28 @@
 #include "application/CourseInfo.hpp"
 #include "application/CourseRepository.hpp"
 #include "application/ShotParameterService.hpp"
+#include "application/ShotSolver.hpp"
 #include "application/UseCases.hpp"
+#include "application/ArcPreviewService.hpp"
+#include "application/CoordinateConverter.hpp"
+#include "application/DispersionService.hpp"
+#include "application/ImpactDetector.hpp"
+#include "application/LandingTable.hpp"
+#include "application/ThreadPool.hpp"
 #include "application/ScreenFlow.hpp"
+#include "application/SimulationThread.hpp"
+#include "infrastructure/EventQueue.hpp"
+#include "infrastructure/InputThread.hpp"
 #include "infrastructure/MockSensorProvider.hpp"
+#include "infrastructure/ReplaySensorProvider.hpp"
+#include "infrastructure/TraceRecorder.hpp"
 #include "infrastructure/FileCourseRepository.hpp"
+#include "infrastructure/FileLandingCacheRepository.hpp"
 #include <memory>
 
 // Forward declaration to avoid raylib include here
 class Renderer;
+struct GreenData;
 
 // Composition Root: assembles all layers
 class App {
@@ -25,8 +39,11 @@ public:
 
 private:
   void setup();
+  void loadHole(int hole_number);
   void handleInput();
+  void pollSensors();
   void update(double dt);
+  void updateDispersion();
   void render();
 
   // Configuration
@@ -37,21 +54,57 @@ private:
   domain::PhysicsConfig physics_config_;
   domain::GameStateMachine state_machine_;
   domain::PhysicsEngine physics_;
+  std::shared_ptr<const domain::WindField> wind_field_;  // Current hole's wind
   
   // Application layer
   application::ShotParameterService shot_service_;
   application::ShotParameters current_params_;
+  application::ShotSolver shot_solver_;       // Caddie advice toward the pin
+  application::ShotSolution caddie_advice_;
+  application::ArcPreviewService arc_preview_;  // Predicted arc while aiming
   std::unique_ptr<application::ExecuteShotUseCase> execute_shot_;
   std::unique_ptr<application::UpdatePhysicsUseCase> update_physics_;
+  // Sole driver of physics_ and state_machine_ (on its own thread when
+  // GOLF_SIM_THREAD is set); input and rendering go through it
+  std::unique_ptr<application::SimulationThread> simulation_;
   std::unique_ptr<application::CourseRepository> course_repo_;
   application::CourseInfo current_course_;
   
+  // Landing dispersion preview for the current parameters (Armed state),
+  // recomputed in the background when club, power or aim change
+  std::unique_ptr<application::ThreadPool> thread_pool_;
+  std::unique_ptr<application::DispersionService> dispersion_;
+  application::DispersionResult dispersion_result_;
+  application::ShotParameters dispersion_params_;
+  bool dispersion_valid_ = false;
+  
   // Infrastructure layer
-  std::unique_ptr<infrastructure::MockSensorProvider> sensor_provider_;
+  // Mock by default; a recorded trace when GOLF_SIM_TRACE is set
+  std::unique_ptr<infrastructure::ISensorProvider> sensor_provider_;
+  infrastructure::MockSensorProvider* mock_sensor_ = nullptr;  // Null when replaying
+  // Sensor frames on their way to the game loop; drops shown on the HUD.
+  // One second of a 4 kHz IMU, so a stalled frame loses nothing.
+  infrastructure::EventQueue sensor_events_{4096};
+  uint64_t sensor_events_handled_ = 0;
+  // Shoots from the sensor stream (replayed traces; the mock's impact
+  // frame only echoes a keyboard shot)
+  application::ImpactDetector impact_detector_;
+  // Sole poller of sensor_provider_ (declared after both: stopped first)
+  std::unique_ptr<infrastructure::InputThread> input_thread_;
+  // Copies every drained event to GOLF_SIM_RECORD, off the game loop
+  std::unique_ptr<infrastructure::TraceRecorder> trace_recorder_;
+  std::unique_ptr<infrastructure::FileLandingCacheRepository> landing_cache_;
+  
+  // Instant landing estimates for the HUD (built in the background or
+  // mapped from landing_cache_; declared after it so it is destroyed first)
+  std::unique_ptr<application::LandingTable> landing_table_;
   
   // Presentation layer (raylib dependency)
   std::unique_ptr<Renderer> renderer_;
   
+  // Per-frame render buffers, reused so drawing a flight does not allocate
+  std::unique_ptr<GreenData> green_;
+  
   // UI state (presentation concern)
   int hole_number_ = 1;
   int current_par_ = 4;
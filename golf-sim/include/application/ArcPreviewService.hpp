@@ -0,0 +1,106 @@
+#pragma once
+
+#include "application/ShotParameterService.hpp"
+#include "domain/PhysicsConfig.hpp"
+#include "domain/PhysicsEngine.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace application {
+
+struct ArcPreviewConfig {
+  double step_sec = 1.0 / 60.0;       // Coarse RK4 step: preview, not result
+  int max_steps_per_frame = 240;      // Compute budget per update() call
+  size_t cache_entries = 16;          // Memoized arcs (least recently used evicted)
+  size_t max_points = 256;            // Points per arc
+  float power_quantum = 0.005f;       // Parameter changes below these reuse the arc
+  float aim_quantum_deg = 0.25f;
+};
+
+// Application service: predicted flight arc for the current ShotParameters
+//
+// Arcs are memoized by quantized parameters. A cache miss starts a
+// simulation that advances at most max_steps_per_frame steps per update();
+// until it lands, the last finished arc keeps being shown. A computation
+// in progress is finished before the newest request is started, so fast
+// input changes still produce intermediate arcs.
+class ArcPreviewService {
+public:
+  struct ArcPoint {
+    float x, y, z;  // Physics coordinates (m)
+  };
+  
+  ArcPreviewService(const ShotParameterService& shot_service,
+                    const domain::PhysicsConfig& physics_config,
+                    const ArcPreviewConfig& config = ArcPreviewConfig());
+  
+  // Call once per frame; returns the arc to draw (empty before the first
+  // arc is ready)
+  const std::vector<ArcPoint>& update(const ShotParameters& params);
+  
+  // Arcs through a hole's varying wind (null: constant wind only), at the
+  // gust phase of time 0. Drops the cached arcs and any arc in progress;
+  // the last one stays shown until its replacement is ready.
+  void setWindField(std::shared_ptr<const domain::WindField> field);
+  
+  // Last finished arc (what update() returned)
+  const std::vector<ArcPoint>& getArc() const { return shown_; }
+  
+  // True while a requested arc is still being computed
+  bool isPending() const { return pending_ || (has_request_ && request_key_ != shown_key_); }
+  
+  long getComputeCount() const { return computed_; }
+  long getCacheHits() const { return cache_hits_; }
+  
+private:
+  struct Key {
+    int club = 0;
+    int32_t power = 0;
+    int32_t aim = 0;
+    int32_t spin_axis = 0;
+    bool operator==(const Key& o) const {
+      return club == o.club && power == o.power && aim == o.aim && spin_axis == o.spin_axis;
+    }
+    bool operator!=(const Key& o) const { return !(*this == o); }
+  };
+  
+  struct Entry {
+    Key key;
+    bool valid = false;
+    unsigned long last_used = 0;
+    std::vector<ArcPoint> points;
+  };
+  
+  Key quantize(const ShotParameters& params) const;
+  ShotParameters dequantize(const Key& key) const;
+  Entry* find(const Key& key);
+  void show(Entry& entry);
+  void start(const Key& key);
+  void advance();
+  void finish();
+  
+  const ShotParameterService& shot_service_;
+  domain::PhysicsConfig physics_config_;
+  ArcPreviewConfig config_;
+  domain::PhysicsEngine engine_;
+  std::shared_ptr<const domain::WindField> wind_field_;  // Flown by engine_
+  
+  std::vector<Entry> cache_;
+  unsigned long clock_ = 0;
+  
+  std::vector<ArcPoint> shown_;
+  Key shown_key_;
+  bool has_shown_ = false;
+  
+  Key request_key_;
+  bool has_request_ = false;
+  Key pending_key_;
+  bool pending_ = false;
+  
+  long computed_ = 0;
+  long cache_hits_ = 0;
+};
+
+} // namespace application
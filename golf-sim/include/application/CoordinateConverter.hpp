@@ -34,11 +34,23 @@ public:
     float y;       // Downfield position in render space (domain y + TEE_RENDER_OFFSET_Y)
     float height;  // Height above ground (unchanged from domain z)
   };
+  // Trajectories are written as packed xyz triples by the SIMD layer
+  static_assert(sizeof(RenderPoint) == 3 * sizeof(float), "RenderPoint must be three packed floats");
 
   static RenderPoint toRenderCoordinates(const domain::Vec3& domain_pos);
   
   // Convert entire trajectory to render coordinates
   static std::vector<RenderPoint> toRenderTrajectory(const domain::Trajectory& trajectory);
+  
+  // Convert the part of a trajectory recorded up to until_t_sec
+  // (used while a precomputed flight is being played back)
+  static std::vector<RenderPoint> toRenderTrajectory(const domain::Trajectory& trajectory,
+                                                     double until_t_sec);
+  
+  // Same as above, writing into a caller-owned buffer so per-frame
+  // conversion reuses its storage instead of allocating
+  static void toRenderTrajectory(const domain::Trajectory& trajectory, double until_t_sec,
+                                 std::vector<RenderPoint>& out);
 };
 
 } // namespace application
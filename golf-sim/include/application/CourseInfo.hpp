@@ -6,6 +6,8 @@ struct CourseInfo {
   int hole_number = 1;
   int par = 4;
   double pin_distance_m = 200.0;
+  double wind_speed_mps = 0.0;       // At 10 m
+  double wind_direction_deg = 90.0;  // Blowing toward, CCW from +x (90 = tailwind)
 };
 
 } // namespace application
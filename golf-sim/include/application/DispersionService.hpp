@@ -0,0 +1,120 @@
+#pragma once
+
+#include "application/ShotParameterService.hpp"
+#include "application/ThreadPool.hpp"
+#include "domain/PhysicsConfig.hpp"
+#include "domain/Vec3.hpp"
+#include "domain/WindField.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace application {
+
+// Shot-to-shot variation around the nominal launch (1 sigma, normal)
+struct DispersionSpread {
+  double speed_pct = 1.5;            // % of launch speed
+  double launch_angle_deg = 1.0;
+  double aim_deg = 1.5;
+  double spin_pct = 8.0;             // % of spin rate
+  double gust_mps = 1.0;             // Per-shot horizontal gust on top of the wind
+};
+
+// Ellipse containing a given fraction of the landings, centered on the mean
+struct DispersionContour {
+  double percentile = 0.0;           // 0.5 = half of the landings inside
+  double semi_major_m = 0.0;
+  double semi_minor_m = 0.0;
+  double angle_rad = 0.0;            // Major axis, from +x toward +y
+};
+
+struct DispersionResult {
+  std::vector<domain::Vec3> landings;     // Landing points in sample order
+  domain::Vec3 mean;
+  double cov_xx = 0.0;
+  double cov_xy = 0.0;
+  double cov_yy = 0.0;
+  std::vector<DispersionContour> contours;  // One per CONTOUR_PERCENTILES
+};
+
+// Application service: Monte Carlo landing dispersion for ShotParameters
+//
+// Samples are simulated in fixed-size chunks on the thread pool. Each
+// chunk draws from its own random stream derived from (seed, chunk), and
+// statistics are reduced in sample order, so a result depends only on
+// the inputs, never on the thread count or scheduling.
+//
+// Per-frame callers use request()/poll(): the analysis runs on a
+// background thread (driving the pool from there) and the last finished
+// cloud stays valid meanwhile. One analysis runs at a time; requests made
+// while it runs collapse into the newest, started when it finishes.
+class DispersionService {
+public:
+  static constexpr size_t CHUNK_SIZE = 64;
+  static constexpr double CONTOUR_PERCENTILES[2] = {0.5, 0.9};
+  
+  DispersionService(const ShotParameterService& shot_service,
+                    const domain::PhysicsConfig& physics_config,
+                    ThreadPool& pool,
+                    const DispersionSpread& spread = DispersionSpread());
+  ~DispersionService();  // Waits for a running request
+  
+  DispersionService(const DispersionService&) = delete;
+  DispersionService& operator=(const DispersionService&) = delete;
+  
+  // Fly through a hole's varying wind (null: constant wind only), at the
+  // gust phase of time 0. A running request stops at its next chunk;
+  // its result and any queued one are dropped.
+  void setWindField(std::shared_ptr<const domain::WindField> field);
+  
+  // Simulate `samples` perturbed launches; `out` storage is reused.
+  // Blocks; not while a request is running.
+  void analyze(const ShotParameters& params, size_t samples, uint64_t seed,
+               DispersionResult& out) const;
+  
+  // Start analyze() in the background, or queue it behind the running one
+  void request(const ShotParameters& params, size_t samples, uint64_t seed);
+  
+  // Swap a finished request's result into `out` (true), then start the
+  // queued one if any. False (out untouched) while nothing new is done.
+  bool poll(DispersionResult& out);
+  
+  // Block until the running request is done (tests, tools); poll() then
+  // returns its result
+  void wait();
+  
+  bool isBusy() const { return worker_.joinable() || has_next_job_; }
+  
+  const DispersionSpread& getSpread() const { return spread_; }
+
+private:
+  struct Job {
+    ShotParameters params;
+    size_t samples = 0;
+    uint64_t seed = 0;
+  };
+  
+  void computeStatistics(DispersionResult& out) const;
+  void launch(const Job& job);
+  void cancel();
+  
+  const ShotParameterService& shot_service_;
+  domain::PhysicsConfig physics_config_;
+  ThreadPool& pool_;
+  DispersionSpread spread_;
+  std::shared_ptr<const domain::WindField> wind_field_;
+  mutable std::vector<double> distances_;  // Scratch for percentiles
+  
+  // Background request; job_result_ belongs to worker_ until job_done_
+  std::thread worker_;
+  std::atomic<bool> job_done_{false};
+  std::atomic<bool> cancel_{false};       // Set by cancel(); analyze() bails out
+  DispersionResult job_result_;
+  Job next_job_;
+  bool has_next_job_ = false;
+};
+
+} // namespace application
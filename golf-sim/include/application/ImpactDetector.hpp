@@ -0,0 +1,57 @@
+#pragma once
+
+#include "application/ShotParameterService.hpp"
+#include "application/SimulationThread.hpp"
+#include <cstdint>
+#include <limits>
+
+namespace application {
+
+struct ImpactDetectorConfig {
+  float threshold_mps2 = 15.0f;    // Vertical acceleration that starts an impact (rest ~9.81)
+  float full_power_mps2 = 40.0f;   // Peak that maps to full power
+  double refractory_sec = 0.25;    // Ringing after an impact is ignored
+};
+
+// A club-ball impact found in the IMU stream
+struct Impact {
+  double t_sec = 0.0;              // Time of the peak sample
+  float peak_mps2 = 0.0f;
+  float power = 0.0f;              // Shot power in [0.1, 1]
+};
+
+// Application service: turns IMU samples into shots
+//
+// An impact is a run of samples at or above threshold_mps2, reported once
+// the run ends (at its peak sample), with power growing linearly from the
+// threshold to full_power_mps2. Samples within refractory_sec of a peak
+// are ignored. Samples must arrive in time order.
+class ImpactDetector {
+public:
+  static constexpr float MIN_POWER = 0.1f;  // Same limits as the input UI
+  static constexpr float MAX_POWER = 1.0f;
+  
+  explicit ImpactDetector(const ImpactDetectorConfig& config = ImpactDetectorConfig());
+  
+  // Feed one sample; true when it completes an impact (written to `out`)
+  bool update(double t_sec, float az, Impact& out);
+  
+  // Forget a run in progress and the refractory period (e.g. after a seek)
+  void reset();
+  
+  // Shoot command for an impact: the player's club, aim and spin axis,
+  // with the power of the impact
+  static SimulationCommand shotCommand(const Impact& impact, const ShotParameters& params,
+                                       double wind_time_offset_sec = 0.0);
+  
+  uint64_t getImpactCount() const { return impacts_; }
+
+private:
+  ImpactDetectorConfig config_;
+  bool in_impact_ = false;
+  Impact peak_;
+  double quiet_until_sec_ = -std::numeric_limits<double>::infinity();
+  uint64_t impacts_ = 0;
+};
+
+} // namespace application
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace application {
+
+// Read-only block of cached floats; stays valid while the object lives
+class CachedFloats {
+public:
+  virtual ~CachedFloats() = default;
+  virtual const float* data() const = 0;
+  virtual size_t size() const = 0;
+};
+
+// Persistence for precomputed tables (e.g. LandingTable), keyed by a hash
+// of everything the table depends on
+class LandingCacheRepository {
+public:
+  virtual ~LandingCacheRepository() = default;
+  
+  // Cached table for `key`, or nullptr if missing, stale or damaged
+  virtual std::unique_ptr<CachedFloats> load(uint64_t key) const = 0;
+  virtual bool save(uint64_t key, const float* data, size_t count) = 0;
+};
+
+} // namespace application
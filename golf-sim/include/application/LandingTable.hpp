@@ -0,0 +1,101 @@
+#pragma once
+
+#include "application/LandingCacheRepository.hpp"
+#include "application/ShotParameterService.hpp"
+#include "domain/PhysicsConfig.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace application {
+
+// Grid of the precomputed table (per club: power x aim x wind_x x wind_y)
+struct LandingTableLayout {
+  int power_points = 19;      // 0.1 .. 1.0
+  int aim_points = 13;        // -30 .. +30 deg
+  int wind_points = 9;        // -10 .. +10 m/s, per horizontal component
+  float min_power = 0.1f;
+  float max_power = 1.0f;
+  float max_aim_deg = 30.0f;
+  float max_wind_mps = 10.0f;
+};
+
+struct LandingEstimate {
+  double x = 0.0;             // Lateral (m)
+  double y = 0.0;             // Downrange (m)
+  double flight_time_s = 0.0;
+};
+
+struct LandingTableValidation {
+  size_t samples = 0;
+  double max_error_m = 0.0;
+  double mean_error_m = 0.0;
+};
+
+// Application service: instant "where does this shot land" queries
+//
+// Landing points are simulated once over the grid (headless RK45, spin
+// axis 0) on a background thread, or mapped from the cache repository when
+// a table with the same key exists. Queries interpolate multilinearly
+// between the 16 surrounding grid points of the club's 4D table.
+class LandingTable {
+public:
+  LandingTable(const ShotParameterService& shot_service,
+               const domain::PhysicsConfig& physics_config,
+               LandingCacheRepository* cache = nullptr,
+               const LandingTableLayout& layout = LandingTableLayout());
+  ~LandingTable();
+  
+  LandingTable(const LandingTable&) = delete;
+  LandingTable& operator=(const LandingTable&) = delete;
+  
+  // Load from cache, or start building on a background thread
+  void start();
+  
+  // Block until the table is ready (tests, tools)
+  void wait();
+  
+  bool isReady() const { return ready_.load(std::memory_order_acquire); }
+  bool isFromCache() const { return from_cache_; }
+  
+  // Interpolated landing; false until the table is ready. Inputs outside
+  // the grid are clamped.
+  bool lookup(int club_index, double power, double aim_deg,
+              const domain::Vec3& wind, LandingEstimate& out) const;
+  
+  // Compare against full simulation at off-grid points
+  LandingTableValidation validate(size_t samples) const;
+  
+  // Hash of everything the table depends on (cache key)
+  uint64_t getKey() const { return key_; }
+  
+private:
+  static constexpr int VALUES = 3;  // x, y, flight time
+  
+  void build();
+  uint64_t computeKey() const;
+  size_t tableSize() const;
+  size_t index(int club, int ip, int ia, int iwx, int iwy) const;
+  LandingEstimate simulate(int club_index, double power, double aim_deg,
+                           const domain::Vec3& wind) const;
+  
+  const ShotParameterService& shot_service_;
+  domain::PhysicsConfig physics_config_;
+  LandingCacheRepository* cache_;
+  LandingTableLayout layout_;
+  uint64_t key_ = 0;
+  
+  std::vector<float> built_;
+  std::unique_ptr<CachedFloats> mapped_;
+  const float* values_ = nullptr;
+  bool from_cache_ = false;
+  
+  std::thread builder_;
+  std::atomic<bool> ready_{false};
+  std::atomic<bool> cancel_{false};
+};
+
+} // namespace application
@@ -9,6 +9,7 @@ struct ShotParameters {
   int club_index = 0;
   float power = 0.7f;       // 0.0 to 1.0
   float aim_angle_deg = 0.0f;  // -30 to +30
+  float spin_axis_deg = 0.0f;  // Spin axis tilt: + slices right, - hooks left
   
   ShotParameters() = default;
 };
@@ -19,6 +20,8 @@ struct ClubData {
   double base_speed_mps;
   double base_angle_deg;
   double distance_avg_m;
+  double base_spin_rpm;   // Backspin at full power
+  double nominal_carry_m; // Full-power reference carry, baked at compile time
 };
 
 // Application service: translate user parameters to domain launch conditions
@@ -34,9 +37,6 @@ public:
   // Get club data
   const ClubData& getClubData(int index) const;
   int getClubCount() const { return NUM_CLUBS; }
-  
-private:
-  static const ClubData clubs_[NUM_CLUBS];
 };
 
 } // namespace application
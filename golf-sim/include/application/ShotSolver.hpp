@@ -0,0 +1,74 @@
+#pragma once
+
+#include "application/ShotParameterService.hpp"
+#include "domain/PhysicsConfig.hpp"
+#include "domain/PhysicsEngine.hpp"
+#include <memory>
+
+namespace application {
+
+// Where the ball should land, relative to the tee (+y downrange, +x right)
+struct ShotTarget {
+  double distance_m = 0.0;
+  double lateral_m = 0.0;
+};
+
+// Power and aim that land on the target ("caddie" advice)
+struct ShotSolution {
+  enum class Status {
+    Solved,        // Lands within TOLERANCE_M of the target
+    TooLong,       // Short of the target even at full power
+    TooShort,      // Past the target even at minimum power
+    NotConverged   // No fix within MAX_ITERATIONS, or it needs aim past MAX_AIM_DEG
+  };
+  
+  float power = 0.0f;
+  float aim_angle_deg = 0.0f;
+  domain::Vec3 landing;       // Simulated landing point (last attempt unless Solved)
+  Status status = Status::NotConverged;
+  int simulations = 0;        // Flights simulated by this solve
+};
+
+// Application service: inverse of ShotParameterService + PhysicsEngine
+//
+// Range is solved over power with a bracketed secant (falls back to
+// bisection when a secant step leaves the bracket); the landing bearing is
+// corrected over aim at the same time. Each iteration is one headless RK45
+// flight. The previous solution and secant slope seed the next solve, so
+// re-solving every frame while inputs drift costs one or two flights.
+class ShotSolver {
+public:
+  static constexpr float MIN_POWER = 0.1f;   // Same limits as the input UI
+  static constexpr float MAX_POWER = 1.0f;
+  static constexpr float MAX_AIM_DEG = 30.0f;
+  static constexpr int MAX_ITERATIONS = 12;
+  static constexpr double TOLERANCE_M = 0.05;
+  
+  ShotSolver(const ShotParameterService& shot_service, const domain::PhysicsConfig& physics_config);
+  
+  ShotSolution solve(int club_index, const ShotTarget& target, float spin_axis_deg = 0.0f);
+  
+  // Forget the warm start (e.g. after the wind changes)
+  void invalidate() { warm_valid_ = false; }
+  
+  // Solve through a hole's varying wind (null: constant wind only), at the
+  // gust phase of time 0; forgets the warm start
+  void setWindField(std::shared_ptr<const domain::WindField> field);
+
+private:
+  domain::Vec3 simulate(const ShotParameters& params);
+  
+  const ShotParameterService& shot_service_;
+  domain::PhysicsConfig physics_config_;
+  domain::PhysicsEngine engine_;
+  std::shared_ptr<const domain::WindField> wind_field_;  // Flown by engine_
+  
+  // Warm start
+  bool warm_valid_ = false;
+  int warm_club_ = -1;
+  float warm_power_ = 0.0f;
+  float warm_aim_deg_ = 0.0f;
+  double warm_slope_ = 0.0;   // Last secant slope (m of range per unit power)
+};
+
+} // namespace application
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "application/CoordinateConverter.hpp"
+#include "application/ShotParameterService.hpp"
+#include "application/TripleBuffer.hpp"
+#include "application/UseCases.hpp"
+#include "domain/GameStateMachine.hpp"
+#include "domain/PhysicsEngine.hpp"
+#include "domain/WindField.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace application {
+
+// Input from the UI to the simulation; applied at the start of a tick
+struct SimulationCommand {
+  enum class Type {
+    Arm,       // Idle/Result -> Armed
+    Shoot,     // Armed -> InFlight with params
+    NextHole   // Reset the ball, go Idle, fly through wind_field (on top of
+               // the configured wind_velocity) from now on
+  };
+  
+  Type type = Type::Arm;
+  ShotParameters params;
+  double wind_time_offset_sec = 0.0;                  // Shoot: gust phase
+  std::shared_ptr<const domain::WindField> wind_field;  // NextHole (may be null)
+};
+
+// Immutable view of the simulation after one tick, for the render thread
+struct SimulationSnapshot {
+  uint64_t tick = 0;
+  double sim_time_sec = 0.0;
+  domain::GameState game_state = domain::GameState::Idle;
+  domain::BallState ball;
+  std::vector<CoordinateConverter::RenderPoint> trail;  // Recorded flight up to ball.t_sec
+  bool result_available = false;
+  domain::ShotResult result;                            // Valid if result_available
+};
+
+struct SimulationConfig {
+  double rate_hz = 240.0;        // Fixed tick rate of the thread
+  int max_catch_up_ticks = 8;    // Late ticks run back to back, then time is dropped
+};
+
+// Application service: owns the advance of PhysicsEngine and
+// GameStateMachine.
+//
+// Single-threaded use: call advance(dt) once per frame. Threaded use:
+// start() runs fixed-rate ticks on a steady clock in a thread of its own,
+// and the engine and state machine must then only be touched through
+// post(). Either way the render side reads latest(), which never blocks.
+class SimulationThread {
+public:
+  SimulationThread(domain::GameStateMachine& state_machine,
+                   domain::PhysicsEngine& physics,
+                   ExecuteShotUseCase& execute_shot,
+                   UpdatePhysicsUseCase& update_physics,
+                   const SimulationConfig& config = SimulationConfig());
+  ~SimulationThread();
+  
+  SimulationThread(const SimulationThread&) = delete;
+  SimulationThread& operator=(const SimulationThread&) = delete;
+  
+  void start();
+  void stop();
+  bool isRunning() const { return running_.load(std::memory_order_relaxed); }
+  
+  // Any thread; applied at the next tick
+  void post(const SimulationCommand& command);
+  
+  // One tick on the calling thread (single-threaded mode; not while running)
+  void advance(double dt);
+  
+  // Render thread: newest published snapshot
+  const SimulationSnapshot& latest();
+  
+  // Thread statistics
+  uint64_t getTickCount() const { return ticks_.load(std::memory_order_relaxed); }
+  uint64_t getLateTickCount() const { return late_ticks_.load(std::memory_order_relaxed); }
+  uint64_t getDroppedTickCount() const { return dropped_ticks_.load(std::memory_order_relaxed); }
+
+private:
+  void run();
+  void tick(double dt);
+  void applyCommands();
+  void publish();
+  
+  domain::GameStateMachine& state_machine_;
+  domain::PhysicsEngine& physics_;
+  ExecuteShotUseCase& execute_shot_;
+  UpdatePhysicsUseCase& update_physics_;
+  SimulationConfig config_;
+  
+  std::mutex command_mutex_;
+  std::vector<SimulationCommand> pending_;
+  std::vector<SimulationCommand> applying_;  // Swapped with pending_ each tick
+  std::shared_ptr<const domain::WindField> wind_field_;
+  
+  TripleBuffer<SimulationSnapshot> snapshots_;
+  uint64_t tick_index_ = 0;
+  double sim_time_sec_ = 0.0;
+  
+  std::thread thread_;
+  std::atomic<bool> running_{false};
+  std::atomic<uint64_t> ticks_{0};
+  std::atomic<uint64_t> late_ticks_{0};
+  std::atomic<uint64_t> dropped_ticks_{0};
+};
+
+} // namespace application
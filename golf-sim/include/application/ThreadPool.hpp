@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace application {
+
+// Fixed set of worker threads for data-parallel jobs (one job at a time)
+// Work is handed out by index; which thread runs an index is unspecified,
+// so jobs must not depend on it for their results.
+class ThreadPool {
+public:
+  // threads = 0: one per hardware core (the calling thread counts as one)
+  explicit ThreadPool(size_t threads = 0);
+  ~ThreadPool();
+  
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  
+  // Run fn(i) for every i in [0, count) and block until all are done;
+  // the calling thread takes part
+  void parallelFor(size_t count, const std::function<void(size_t)>& fn);
+  
+  size_t getThreadCount() const { return workers_.size() + 1; }
+  
+private:
+  void workerLoop();
+  void runIndices(const std::function<void(size_t)>& fn, size_t count);
+  
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  const std::function<void(size_t)>* job_ = nullptr;
+  size_t job_count_ = 0;
+  std::atomic<size_t> next_index_{0};
+  size_t busy_workers_ = 0;
+  unsigned long generation_ = 0;
+  bool stopping_ = false;
+};
+
+} // namespace application
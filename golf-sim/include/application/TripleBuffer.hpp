@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace application {
+
+// Lock-free triple buffer: one writer thread publishes complete values,
+// one reader thread takes the newest. Neither side ever blocks or waits.
+//
+// The writer fills writeBuffer() and calls publish(), which swaps it with
+// the shared middle slot. The reader's acquire() swaps the middle slot
+// into its front slot if something new was published since its last
+// acquire; the front slot is then stable until the next acquire(). Values
+// published between two acquires are skipped, never torn. Slots are
+// reused, so T's heap storage (vectors) is allocated only while warming up.
+template <typename T>
+class TripleBuffer {
+public:
+  TripleBuffer() = default;
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+  
+  // Writer side
+  T& writeBuffer() { return slots_[back_]; }
+  void publish() {
+    uint8_t previous = middle_.exchange(static_cast<uint8_t>(back_ | FRESH), std::memory_order_acq_rel);
+    back_ = previous & INDEX_MASK;
+  }
+  
+  // Reader side: true if a newer value was taken
+  bool acquire() {
+    if ((middle_.load(std::memory_order_relaxed) & FRESH) == 0) {
+      return false;
+    }
+    uint8_t previous = middle_.exchange(front_, std::memory_order_acq_rel);
+    front_ = previous & INDEX_MASK;
+    return true;
+  }
+  const T& readBuffer() const { return slots_[front_]; }
+
+private:
+  static constexpr uint8_t INDEX_MASK = 0x3;
+  static constexpr uint8_t FRESH = 0x4;
+  
+  T slots_[3];
+  // Writer and reader indices on their own cache lines, away from the
+  // shared middle index
+  alignas(64) uint8_t back_ = 0;
+  alignas(64) std::atomic<uint8_t> middle_{1};
+  alignas(64) uint8_t front_ = 2;
+};
+
+} // namespace application
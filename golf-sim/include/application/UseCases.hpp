@@ -24,7 +24,7 @@ private:
   ShotParameterService& shot_service_;
 };
 
-// Use case: Update physics during flight
+// Use case: Update physics during flight and roll
 class UpdatePhysicsUseCase {
 public:
   UpdatePhysicsUseCase(
@@ -32,7 +32,7 @@ public:
     domain::PhysicsEngine& physics
   );
   
-  // Update physics, check for landing
+  // Update physics, finish the shot when the ball comes to rest
   void update(double dt);
   
 private:
@@ -0,0 +1,124 @@
+#pragma once
+
+namespace domain {
+
+// Value object: aerodynamic coefficients of a golf ball
+struct AeroCoefficients {
+  double drag = 0.0;  // Cd
+  double lift = 0.0;  // Cl
+};
+
+namespace aero_table {
+
+inline constexpr int RE_POINTS = 16;
+inline constexpr int SPIN_POINTS = 11;
+inline constexpr double RE_STEP = 16000.0;     // Re = 0 .. 240000
+inline constexpr double SPIN_STEP = 0.05;      // S = 0 .. 0.5
+
+struct Cell {
+  float drag;
+  float lift;
+};
+
+// Dimpled ball coefficients sampled from smooth fits: drag crisis around
+// Re ~ 6.5e4 (Cd 0.50 -> 0.23), drag rising with spin, lift rising with
+// spin ratio and saturating above S ~ 0.3 (after Bearman & Harvey and
+// Smits & Smith). Drag and lift share a cell so one lookup touches four
+// adjacent 8-byte cells.
+inline constexpr Cell TABLE[SPIN_POINTS][RE_POINTS] = {
+  // S = 0.00
+  {{0.499f, 0.000f}, {0.495f, 0.000f}, {0.483f, 0.000f}, {0.446f, 0.000f},
+   {0.368f, 0.000f}, {0.286f, 0.000f}, {0.244f, 0.000f}, {0.230f, 0.000f},
+   {0.228f, 0.000f}, {0.229f, 0.000f}, {0.232f, 0.000f}, {0.234f, 0.000f},
+   {0.237f, 0.000f}, {0.240f, 0.000f}, {0.242f, 0.000f}, {0.245f, 0.000f}},
+  // S = 0.05
+  {{0.516f, 0.069f}, {0.513f, 0.069f}, {0.501f, 0.070f}, {0.464f, 0.073f},
+   {0.386f, 0.079f}, {0.304f, 0.086f}, {0.262f, 0.090f}, {0.248f, 0.091f},
+   {0.245f, 0.091f}, {0.247f, 0.091f}, {0.249f, 0.091f}, {0.252f, 0.091f},
+   {0.255f, 0.091f}, {0.257f, 0.091f}, {0.260f, 0.091f}, {0.263f, 0.091f}},
+  // S = 0.10
+  {{0.533f, 0.125f}, {0.529f, 0.126f}, {0.517f, 0.127f}, {0.480f, 0.133f},
+   {0.402f, 0.145f}, {0.320f, 0.157f}, {0.278f, 0.164f}, {0.264f, 0.166f},
+   {0.262f, 0.166f}, {0.263f, 0.166f}, {0.266f, 0.166f}, {0.268f, 0.166f},
+   {0.271f, 0.166f}, {0.274f, 0.166f}, {0.276f, 0.166f}, {0.279f, 0.166f}},
+  // S = 0.15
+  {{0.548f, 0.169f}, {0.545f, 0.170f}, {0.533f, 0.172f}, {0.496f, 0.180f},
+   {0.418f, 0.196f}, {0.336f, 0.213f}, {0.294f, 0.221f}, {0.280f, 0.224f},
+   {0.277f, 0.225f}, {0.279f, 0.225f}, {0.281f, 0.225f}, {0.284f, 0.225f},
+   {0.287f, 0.225f}, {0.289f, 0.225f}, {0.292f, 0.225f}, {0.295f, 0.225f}},
+  // S = 0.20
+  {{0.563f, 0.201f}, {0.559f, 0.202f}, {0.547f, 0.205f}, {0.510f, 0.214f},
+   {0.432f, 0.233f}, {0.350f, 0.253f}, {0.308f, 0.263f}, {0.294f, 0.267f},
+   {0.292f, 0.268f}, {0.293f, 0.268f}, {0.296f, 0.268f}, {0.298f, 0.268f},
+   {0.301f, 0.268f}, {0.304f, 0.268f}, {0.306f, 0.268f}, {0.309f, 0.268f}},
+  // S = 0.25
+  {{0.576f, 0.221f}, {0.573f, 0.222f}, {0.561f, 0.225f}, {0.524f, 0.235f},
+   {0.446f, 0.256f}, {0.364f, 0.278f}, {0.322f, 0.289f}, {0.308f, 0.293f},
+   {0.305f, 0.294f}, {0.307f, 0.294f}, {0.309f, 0.294f}, {0.312f, 0.294f},
+   {0.315f, 0.294f}, {0.317f, 0.294f}, {0.320f, 0.294f}, {0.323f, 0.294f}},
+  // S = 0.30
+  {{0.589f, 0.229f}, {0.585f, 0.230f}, {0.573f, 0.233f}, {0.536f, 0.243f},
+   {0.458f, 0.265f}, {0.376f, 0.288f}, {0.334f, 0.299f}, {0.320f, 0.303f},
+   {0.318f, 0.304f}, {0.319f, 0.304f}, {0.322f, 0.304f}, {0.324f, 0.304f},
+   {0.327f, 0.304f}, {0.330f, 0.304f}, {0.332f, 0.304f}, {0.335f, 0.304f}},
+  // S = 0.35
+  {{0.600f, 0.240f}, {0.597f, 0.241f}, {0.585f, 0.244f}, {0.548f, 0.255f},
+   {0.470f, 0.278f}, {0.388f, 0.302f}, {0.346f, 0.314f}, {0.332f, 0.318f},
+   {0.329f, 0.319f}, {0.331f, 0.319f}, {0.333f, 0.319f}, {0.336f, 0.319f},
+   {0.339f, 0.319f}, {0.341f, 0.319f}, {0.344f, 0.319f}, {0.347f, 0.319f}},
+  // S = 0.40
+  {{0.611f, 0.251f}, {0.607f, 0.252f}, {0.595f, 0.256f}, {0.558f, 0.267f},
+   {0.480f, 0.291f}, {0.398f, 0.316f}, {0.356f, 0.329f}, {0.342f, 0.333f},
+   {0.340f, 0.334f}, {0.341f, 0.334f}, {0.344f, 0.334f}, {0.346f, 0.334f},
+   {0.349f, 0.334f}, {0.352f, 0.334f}, {0.354f, 0.334f}, {0.357f, 0.334f}},
+  // S = 0.45
+  {{0.620f, 0.263f}, {0.617f, 0.264f}, {0.605f, 0.267f}, {0.568f, 0.279f},
+   {0.490f, 0.304f}, {0.408f, 0.330f}, {0.366f, 0.343f}, {0.352f, 0.348f},
+   {0.349f, 0.349f}, {0.351f, 0.349f}, {0.353f, 0.349f}, {0.356f, 0.349f},
+   {0.359f, 0.349f}, {0.361f, 0.349f}, {0.364f, 0.349f}, {0.367f, 0.349f}},
+  // S = 0.50
+  {{0.629f, 0.274f}, {0.625f, 0.275f}, {0.613f, 0.279f}, {0.576f, 0.291f},
+   {0.498f, 0.317f}, {0.416f, 0.344f}, {0.374f, 0.358f}, {0.360f, 0.363f},
+   {0.358f, 0.364f}, {0.359f, 0.364f}, {0.362f, 0.364f}, {0.364f, 0.364f},
+   {0.367f, 0.364f}, {0.370f, 0.364f}, {0.372f, 0.364f}, {0.375f, 0.364f}},
+};
+
+} // namespace aero_table
+
+// Precomputed table lookup (bilinear, clamped to the table range); inline
+// and constexpr so it folds into the force evaluation
+//   reynolds:   Re = |v_rel| * diameter / kinematic viscosity
+//   spin_ratio: S = radius * |omega| / |v_rel|
+constexpr AeroCoefficients lookupAeroCoefficients(double reynolds, double spin_ratio) {
+  using namespace aero_table;
+  
+  // Clamp to the table and split into cell index + fraction
+  double fr = reynolds * (1.0 / RE_STEP);
+  double fs = spin_ratio * (1.0 / SPIN_STEP);
+  fr = fr < 0.0 ? 0.0 : (fr > RE_POINTS - 1 ? RE_POINTS - 1 : fr);
+  fs = fs < 0.0 ? 0.0 : (fs > SPIN_POINTS - 1 ? SPIN_POINTS - 1 : fs);
+  
+  int ir = static_cast<int>(fr);
+  int is = static_cast<int>(fs);
+  ir = ir > RE_POINTS - 2 ? RE_POINTS - 2 : ir;
+  is = is > SPIN_POINTS - 2 ? SPIN_POINTS - 2 : is;
+  double ur = fr - ir;
+  double us = fs - is;
+  
+  const Cell& c00 = TABLE[is][ir];
+  const Cell& c01 = TABLE[is][ir + 1];
+  const Cell& c10 = TABLE[is + 1][ir];
+  const Cell& c11 = TABLE[is + 1][ir + 1];
+  
+  double w00 = (1.0 - ur) * (1.0 - us);
+  double w01 = ur * (1.0 - us);
+  double w10 = (1.0 - ur) * us;
+  double w11 = ur * us;
+  
+  return AeroCoefficients{
+    w00 * c00.drag + w01 * c01.drag + w10 * c10.drag + w11 * c11.drag,
+    w00 * c00.lift + w01 * c01.lift + w10 * c10.lift + w11 * c11.lift
+  };
+}
+
+} // namespace domain
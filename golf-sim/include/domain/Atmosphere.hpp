@@ -0,0 +1,59 @@
+#pragma once
+
+#include "domain/ConstexprMath.hpp"
+
+namespace domain {
+
+// Pure value object: the air at the venue.
+//
+// Station pressure follows the ISA troposphere from altitude; density is
+// the sum of the dry-air and water-vapour partial densities at the given
+// temperature (Tetens saturation pressure), and dynamic viscosity follows
+// Sutherland's law. Defaults are the ISA sea-level standard day
+// (1.225 kg/m^3). Usable in constant expressions.
+struct Atmosphere {
+  static constexpr double GAS_CONSTANT_DRY = 287.058;     // J/(kg K)
+  static constexpr double GAS_CONSTANT_VAPOUR = 461.495;  // J/(kg K)
+  static constexpr double ZERO_CELSIUS_K = 273.15;
+  
+  double altitude_m = 0.0;
+  double temperature_c = 15.0;
+  double relative_humidity = 0.0;            // 0..1
+  double sea_level_pressure_pa = 101325.0;
+  
+  constexpr double temperatureK() const {
+    return temperature_c + ZERO_CELSIUS_K;
+  }
+  
+  // Station pressure: p0 (1 - L h / T0)^(g M / R L)
+  constexpr double pressurePa() const {
+    double ratio = 1.0 - 0.0065 * altitude_m / 288.15;
+    return sea_level_pressure_pa * constexprPow(ratio > 0.0 ? ratio : 0.0, 5.25588);
+  }
+  
+  constexpr double vapourPressurePa() const {
+    double rh = relative_humidity < 0.0 ? 0.0 : (relative_humidity > 1.0 ? 1.0 : relative_humidity);
+    double saturation = 610.78 * constexprExp(17.27 * temperature_c / (temperature_c + 237.3));
+    return rh * saturation;
+  }
+  
+  // kg/m^3; humid air is lighter than dry air at the same pressure
+  constexpr double density() const {
+    double t = temperatureK();
+    double vapour = vapourPressurePa();
+    return (pressurePa() - vapour) / (GAS_CONSTANT_DRY * t) + vapour / (GAS_CONSTANT_VAPOUR * t);
+  }
+  
+  // Pa s (Sutherland)
+  constexpr double dynamicViscosity() const {
+    double t = temperatureK();
+    return 1.458e-6 * t * constexprSqrt(t) / (t + 110.4);
+  }
+  
+  // m^2/s
+  constexpr double kinematicViscosity() const {
+    return dynamicViscosity() / density();
+  }
+};
+
+} // namespace domain
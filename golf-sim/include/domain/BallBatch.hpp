@@ -0,0 +1,62 @@
+#pragma once
+
+#include "domain/BallState.hpp"
+#include "domain/PhysicsConfig.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace domain {
+
+// Pure domain service: advances many balls in lockstep
+//
+// Same model and fixed timestep as PhysicsEngine with AeroModel::Simple
+// (gravity + drag + wind, explicit Euler; spin is carried but ignored),
+// but state is kept as float structure-of-arrays so the kernel runs 4
+// balls per SSE/NEON instruction (SimdMath.hpp). Landed balls are retired
+// through lane masks rather than per-ball branches. Intended for bulk
+// work (dispersion, arc prediction, launch optimization) where only the
+// landing result is needed; no trajectories are recorded.
+class BallBatch {
+public:
+  static constexpr size_t LANES = 4;
+  
+  explicit BallBatch(const PhysicsConfig& config);
+  
+  // Remove all balls (storage is kept)
+  void clear();
+  
+  // Add a ball launched from the origin; returns its index
+  size_t add(const LaunchCondition& launch);
+  
+  // Advance every ball still in flight by one fixed step;
+  // returns true while at least one ball is still in flight
+  bool step();
+  
+  // Step until every ball has landed (or the flight time cap is reached)
+  void run();
+  
+  size_t size() const { return count_; }
+  size_t activeCount() const;
+  double getTime() const { return t_sec_; }
+  
+  bool isInFlight(size_t index) const;
+  ShotResult getResult(size_t index) const;
+  
+private:
+  void reserveFor(size_t count);
+  
+  PhysicsConfig config_;
+  double drag_coefficient_ = 0.0;    // config_.dragCoefficient(), folded once
+  size_t count_ = 0;
+  double t_sec_ = 0.0;
+  
+  // Columns padded to a multiple of LANES
+  std::vector<float> px_, py_, pz_;
+  std::vector<float> vx_, vy_, vz_;
+  std::vector<float> sx_, sy_, sz_;  // Spin (carried along for callers)
+  std::vector<float> land_x_, land_y_, land_t_;
+  std::vector<uint32_t> active_;     // All-ones while in flight, zero once landed
+};
+
+} // namespace domain
@@ -5,18 +5,27 @@
 namespace domain {
 
 // Pure domain entity representing ball state in flight
-struct BallState {
-  double t_sec = 0.0;
-  Vec3 pos;        // Position in meters (x, y, z)
-  Vec3 vel;        // Velocity in m/s
-  Vec3 spin;       // Spin rate (simplified)
+template <typename T>
+struct BasicBallState {
+  T t_sec = T(0);
+  BasicVec3<T> pos;        // Position in meters (x, y, z)
+  BasicVec3<T> vel;        // Velocity in m/s
+  BasicVec3<T> spin;       // Spin rate (simplified)
   bool in_flight = false;
   
-  BallState() = default;
-  BallState(double t, const Vec3& position, const Vec3& velocity)
+  constexpr BasicBallState() = default;
+  constexpr BasicBallState(T t, const BasicVec3<T>& position, const BasicVec3<T>& velocity)
     : t_sec(t), pos(position), vel(velocity), in_flight(true) {}
+  
+  // Precision conversion
+  template <typename U>
+  constexpr explicit BasicBallState(const BasicBallState<U>& other)
+    : t_sec(static_cast<T>(other.t_sec)), pos(other.pos), vel(other.vel), spin(other.spin),
+      in_flight(other.in_flight) {}
 };
 
+using BallState = BasicBallState<double>;
+
 // Value object for initial launch conditions
 struct LaunchCondition {
   Vec3 initial_velocity;  // m/s
@@ -24,20 +33,23 @@ struct LaunchCondition {
   double launch_angle_deg = 0.0;
   double launch_speed_mps = 0.0;
   
-  LaunchCondition() = default;
-  LaunchCondition(double speed, double angle_deg)
+  constexpr LaunchCondition() = default;
+  constexpr LaunchCondition(double speed, double angle_deg)
     : launch_speed_mps(speed), launch_angle_deg(angle_deg) {}
 };
 
 // Value object for shot result
 struct ShotResult {
   double carry_m = 0.0;
-  double total_m = 0.0;
+  double total_m = 0.0;     // Start to rest position
   double lateral_m = 0.0;  // Positive = right, Negative = left
   double flight_time_s = 0.0;
   Vec3 landing_position;
+  Vec3 landing_velocity;   // Velocity at touchdown (m/s)
+  double roll_m = 0.0;     // Bounce and roll distance after touchdown
+  Vec3 rest_position;      // Where the ball stops (landing position without a ground phase)
   
-  ShotResult() = default;
+  constexpr ShotResult() = default;
 };
 
 } // namespace domain
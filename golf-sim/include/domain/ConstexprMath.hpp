@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cmath>
+
+namespace domain {
+
+// Math usable in constant expressions. At runtime each function forwards
+// to <cmath>, so results (and determinism) match the plain std:: calls;
+// during constant evaluation a series / Newton iteration is used instead,
+// accurate to a few ulp.
+
+constexpr double PI = 3.14159265358979323846;
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define GOLF_HAS_IS_CONSTANT_EVALUATED 1
+#endif
+#endif
+#if !defined(GOLF_HAS_IS_CONSTANT_EVALUATED) \
+  && ((defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925))
+#define GOLF_HAS_IS_CONSTANT_EVALUATED 1
+#endif
+
+constexpr bool isConstantEvaluated() {
+#if defined(GOLF_HAS_IS_CONSTANT_EVALUATED)
+  return __builtin_is_constant_evaluated();
+#else
+  // Cannot tell: keep runtime results exact. Constant evaluation then
+  // reaches <cmath> and fails to compile instead of silently diverging.
+  return false;
+#endif
+}
+
+template <typename T>
+constexpr T constexprSqrt(T x) {
+  if (!isConstantEvaluated()) {
+    return std::sqrt(x);
+  }
+  if (!(x > T(0))) {
+    return T(0);
+  }
+  // Scale into [1, 4) by powers of four, then Newton from a linear guess
+  T scale = T(1);
+  while (x >= T(4)) {
+    x /= T(4);
+    scale *= T(2);
+  }
+  while (x < T(1)) {
+    x *= T(4);
+    scale /= T(2);
+  }
+  T r = T(0.5) + T(0.5) * x;
+  for (int i = 0; i < 6; ++i) {
+    r = T(0.5) * (r + x / r);
+  }
+  return r * scale;
+}
+
+namespace constexpr_math_detail {
+
+// sin(x) for |x| <= pi/2 (Taylor series, terms below 1e-17 dropped)
+constexpr double sinReduced(double x) {
+  double x2 = x * x;
+  double term = x;
+  double sum = x;
+  for (int n = 1; n < 12; ++n) {
+    term *= -x2 / ((2 * n) * (2 * n + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+// x mapped to [-pi, pi]
+constexpr double wrapAngle(double x) {
+  double turns = x / (2.0 * PI);
+  long whole = static_cast<long>(turns < 0.0 ? turns - 0.5 : turns + 0.5);
+  return x - static_cast<double>(whole) * (2.0 * PI);
+}
+
+constexpr double LN2 = 0.69314718055994530942;
+
+} // namespace constexpr_math_detail
+
+constexpr double constexprSin(double x) {
+  if (!isConstantEvaluated()) {
+    return std::sin(x);
+  }
+  x = constexpr_math_detail::wrapAngle(x);
+  if (x > PI / 2.0) x = PI - x;
+  if (x < -PI / 2.0) x = -PI - x;
+  return constexpr_math_detail::sinReduced(x);
+}
+
+constexpr double constexprCos(double x) {
+  if (!isConstantEvaluated()) {
+    return std::cos(x);
+  }
+  return constexprSin(constexpr_math_detail::wrapAngle(x) + PI / 2.0);
+}
+
+constexpr double constexprExp(double x) {
+  if (!isConstantEvaluated()) {
+    return std::exp(x);
+  }
+  // x = k ln2 + r with |r| <= ln2 / 2, then a Taylor series for e^r
+  long k = static_cast<long>(x / constexpr_math_detail::LN2 + (x < 0.0 ? -0.5 : 0.5));
+  double r = x - static_cast<double>(k) * constexpr_math_detail::LN2;
+  double term = 1.0;
+  double sum = 1.0;
+  for (int n = 1; n < 18; ++n) {
+    term *= r / n;
+    sum += term;
+  }
+  for (; k > 0; --k) sum *= 2.0;
+  for (; k < 0; ++k) sum /= 2.0;
+  return sum;
+}
+
+constexpr double constexprLog(double x) {
+  if (!isConstantEvaluated()) {
+    return std::log(x);
+  }
+  if (!(x > 0.0)) {
+    return -1e308;
+  }
+  // x = m 2^k with m in [1, 2), then ln m = 2 atanh((m - 1) / (m + 1))
+  int k = 0;
+  while (x >= 2.0) {
+    x /= 2.0;
+    ++k;
+  }
+  while (x < 1.0) {
+    x *= 2.0;
+    --k;
+  }
+  double y = (x - 1.0) / (x + 1.0);
+  double y2 = y * y;
+  double power = y;
+  double sum = 0.0;
+  for (int n = 1; n < 40; n += 2) {
+    sum += power / n;
+    power *= y2;
+  }
+  return 2.0 * sum + k * constexpr_math_detail::LN2;
+}
+
+constexpr double constexprPow(double base, double exponent) {
+  if (!isConstantEvaluated()) {
+    return std::pow(base, exponent);
+  }
+  return constexprExp(exponent * constexprLog(base));
+}
+
+} // namespace domain
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace domain {
+
+// 64-bit FNV-1a, fed one field at a time (never over padded structs, whose
+// padding bytes are unspecified). Shared by the trajectory fingerprint and
+// the landing table cache key.
+class Fnv1a {
+public:
+  template <typename T>
+  void add(const T& value) {
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    for (unsigned char b : bytes) {
+      hash_ = (hash_ ^ b) * 0x100000001B3ull;
+    }
+  }
+  // A string's characters plus its terminator, so "ab","c" != "a","bc"
+  void add(const char* text) {
+    for (; *text; ++text) {
+      hash_ = (hash_ ^ static_cast<unsigned char>(*text)) * 0x100000001B3ull;
+    }
+    add('\0');
+  }
+  uint64_t value() const { return hash_; }
+
+private:
+  uint64_t hash_ = 0xCBF29CE484222325ull;
+};
+
+} // namespace domain
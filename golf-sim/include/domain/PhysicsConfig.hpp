@@ -1,17 +1,82 @@
 #pragma once
 
+#include "domain/Atmosphere.hpp"
 #include "domain/Vec3.hpp"
+#include <cstddef>
 
 namespace domain {
 
-// Pure value object for physics configuration
+// Pure value object for physics configuration (a literal type: usable in
+// constant expressions, see ReferenceFlight.hpp)
 struct PhysicsConfig {
+  // Integration scheme. Euler and RK4 advance in fixed dt_fixed_sec steps;
+  // RK45 (Dormand-Prince) picks its own step size under error control and
+  // samples the trajectory every dt_fixed_sec from its dense output.
+  // All three are deterministic for a given config and launch.
+  enum class Integrator { Euler, RK4, RK45 };
+  
+  // Aerodynamics. Simple applies a constant quadratic drag and ignores
+  // spin; SpinAware looks up Cd/Cl by Reynolds number and spin ratio,
+  // adds Magnus lift along spin x velocity and decays spin in flight.
+  enum class AeroModel { Simple, SpinAware };
+  
   double gravity = 9.80665;           // m/s^2
-  double drag_coefficient = 0.02;     // Simplified drag
+  double drag_coefficient = 0.02;     // Simplified drag, at air_density_kgpm3
   Vec3 wind_velocity;                 // m/s (x, y, z)
+  
+  AeroModel aero_model = AeroModel::Simple;
+  double air_density_kgpm3 = 1.225;
+  double air_kinematic_viscosity = 1.48e-5;  // m^2/s
+  double ball_mass_kg = 0.04593;
+  double ball_radius_m = 0.021335;
+  double spin_decay_time_sec = 25.0;  // omega(t) = omega0 * exp(-t / tau)
+  
+  // Venue air. Off: air_density_kgpm3 and air_kinematic_viscosity are used
+  // as given. On: both follow from the atmosphere and drag_coefficient
+  // scales with the density ratio. Either way the engine folds them into
+  // its constants once, so the step cost is the same.
+  bool use_atmosphere = false;
+  Atmosphere atmosphere;
   double dt_fixed_sec = 1.0 / 240.0;  // Fixed timestep for determinism
   
-  PhysicsConfig() = default;
+  Integrator integrator = Integrator::Euler;
+  double rk45_rel_tol = 1e-6;         // Per-step relative error target
+  double rk45_abs_tol = 1e-6;         // Per-step absolute error target (m, m/s)
+  double rk45_max_step_sec = 0.25;
+  
+  // Precompute mode: startShot() integrates the whole flight up front and
+  // step() only advances a playback cursor over the stored trajectory
+  bool precompute_flight = false;
+  double max_flight_time_sec = 30.0;  // Safety cap for precomputed flights
+  
+  // Ground phase: after touchdown the ball bounces (restitution, friction
+  // against its spin) and rolls to rest on its own, cheaper fixed step.
+  // Off: the ball stops where it lands.
+  bool ground_phase = false;
+  double ground_dt_sec = 1.0 / 120.0;
+  double ground_restitution = 0.3;          // Rebound / impact normal speed
+  double ground_friction = 0.4;             // Sliding friction during impact
+  double ground_rolling_resistance = 0.35;  // Rolling deceleration / g
+  double ground_min_bounce_speed = 0.5;     // m/s; slower rebounds roll
+  double ground_rest_speed = 0.05;          // m/s; slower rolls stop
+  double max_ground_time_sec = 30.0;        // Safety cap for the ground phase
+  
+  // Trajectory point budget (older points are decimated beyond this)
+  size_t max_trajectory_points = 2000;
+  
+  constexpr PhysicsConfig() = default;
+  
+  // Air properties in effect (see use_atmosphere)
+  constexpr double airDensity() const {
+    return use_atmosphere ? atmosphere.density() : air_density_kgpm3;
+  }
+  constexpr double kinematicViscosity() const {
+    return use_atmosphere ? atmosphere.kinematicViscosity() : air_kinematic_viscosity;
+  }
+  constexpr double dragCoefficient() const {
+    return use_atmosphere ? drag_coefficient * (atmosphere.density() / air_density_kgpm3)
+                          : drag_coefficient;
+  }
 };
 
 } // namespace domain
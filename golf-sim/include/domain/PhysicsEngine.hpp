@@ -3,14 +3,25 @@
 #include "domain/BallState.hpp"
 #include "domain/Trajectory.hpp"
 #include "domain/PhysicsConfig.hpp"
+#include "domain/PhysicsPolicies.hpp"
+#include "domain/WindField.hpp"
 
 namespace domain {
 
 // Pure domain service: deterministic physics with fixed timestep
 // No I/O, no time functions, no random numbers
-class PhysicsEngine {
+//
+// Scalar sets the precision of the integrated state; Integrator, DragModel
+// and SpinModel are policies from PhysicsPolicies.hpp. Member definitions
+// live in PhysicsEngine.cpp, which explicitly instantiates the
+// combinations declared at the end of this header.
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+class BasicPhysicsEngine {
 public:
-  explicit PhysicsEngine(const PhysicsConfig& config);
+  using Vec = BasicVec3<Scalar>;
+  using State = BasicBallState<Scalar>;
+  
+  explicit BasicPhysicsEngine(const PhysicsConfig& config);
   
   // Update physics state with real-time delta (accumulator pattern)
   void step(double dt_real);
@@ -18,11 +29,48 @@ public:
   // Start a new shot with launch conditions
   void startShot(const LaunchCondition& launch);
   
+  // Initial velocity vector for a launch (shared with BallBatch)
+  static Vec3 launchVelocity(const LaunchCondition& launch);
+  
+  // Per-shot wind override (e.g. a gust); takes effect from the next step
+  void setWindVelocity(const Vec3& wind) {
+    config_.wind_velocity = wind;
+    wind_ = Vec(wind);
+  }
+  
+  // Varying wind added to wind_velocity, sampled at (position, flight time
+  // + time_offset_sec); nullptr for constant wind only. Not owned: the
+  // field must outlive its use here.
+  void setWindField(const WindField* field, double time_offset_sec = 0.0) {
+    wind_field_ = field;
+    wind_time_offset_ = time_offset_sec;
+  }
+  
   // Check if ball has landed (z <= 0)
   bool hasLanded() const;
   
+  // True once the ball has stopped (at touchdown without a ground phase)
+  // and the clock has caught up with it; step() is free from then on
+  bool isAtRest() const { return phase_ == Phase::Rest && accumulator_ >= 0.0; }
+  
   // Get current ball state
-  const BallState& getCurrentState() const { return current_state_; }
+  const State& getCurrentState() const { return current_state_; }
+  
+  // Render interpolation. step() leaves a partial step in the accumulator;
+  // drawing previous + alpha * (current - previous) instead of the current
+  // state keeps motion smooth when the physics rate is below the frame
+  // rate (at the cost of one step of latency). Alpha is 1 in precompute
+  // mode and at rest, where the current state is already exact.
+  // Real-time RK45 steps can be far longer than a frame, so the flight
+  // runs up to one step ahead of the clock instead and the ball is drawn
+  // from that step's dense output at the current time (no latency).
+  const State& getPreviousState() const { return previous_state_; }
+  double getInterpolationAlpha() const;
+  State getInterpolatedState() const;
+  
+  // Exact touchdown state (time, position, impact velocity); valid once
+  // isResultAvailable()
+  const State& getLandingState() const { return landing_state_; }
   
   // Get trajectory history
   const Trajectory& getTrajectory() const { return trajectory_; }
@@ -36,15 +84,116 @@ public:
   // Check if currently in flight
   bool isInFlight() const { return current_state_.in_flight; }
   
+  // True once the landing point is known (immediately after startShot in
+  // precompute mode, at touchdown otherwise)
+  bool isResultAvailable() const;
+  
+  // Playback cursor in precompute mode (seconds since impact)
+  double getPlaybackTime() const { return playback_t_; }
+  
+  // Acceleration evaluations since the last startShot (cost metric)
+  long getForceEvaluationCount() const { return force_evaluations_; }
+
 private:
-  void integrate(double dt);
-  Vec3 computeAcceleration(const BallState& state) const;
+  enum class Phase { Flight, Ground, Rest };
+  
+  struct Derivative {
+    Vec dpos;
+    Vec dvel;
+    Vec dspin;
+  };
+  
+  // Dormand-Prince continuous extension over one accepted step
+  struct DenseStep {
+    Scalar t0 = Scalar(0);
+    Scalar h = Scalar(0);
+    Vec pos[5];
+    Vec vel[5];
+    Vec spin0;
+    Vec spin1;              // Spin varies slowly; interpolated linearly
+    State at(Scalar t) const;
+  };
+  
+  // Policy decisions (compile-time constants for fixed policies)
+  PhysicsConfig::Integrator integrator() const { return Integrator::kind(config_); }
+  bool tabulatedDrag() const { return DragModel::tabulated(config_); }
+  bool magnusLift() const { return SpinModel::magnus(config_); }
+  
+  double nextStepSize() const;
+  bool advanceStep();
+  bool advanceFixedStep();
+  bool advanceAdaptiveStep();
+  void precomputeFlight();
+  void advancePlayback(double dt_real);
+  void land(const State& touchdown);
+  bool advanceGroundStep();
+  void bounce(State& state) const;
+  void settle();
+  void record(const State& state, bool keyframe = false);
+  void integrate(Scalar dt);
+  void integrateRK4(Scalar dt);
+  Derivative evaluate(const State& state);
+  static State shifted(const State& state, const Derivative& d, Scalar dt);
+  Vec computeAcceleration(const State& state) const;
+  Vec computeSpinRate(const State& state) const;
   
   PhysicsConfig config_;
-  BallState current_state_;
+  // Constants derived from config_ once, in Scalar precision
+  Scalar dt_fixed_ = Scalar(0);
+  Scalar gravity_ = Scalar(0);
+  Scalar drag_coefficient_ = Scalar(0);
+  Vec wind_;
+  const WindField* wind_field_ = nullptr;
+  double wind_time_offset_ = 0.0;
+  Scalar ball_radius_ = Scalar(0);
+  Scalar aero_k_ = Scalar(0);              // rho * A / (2 m)
+  Scalar reynolds_per_speed_ = Scalar(0);  // diameter / nu
+  Scalar spin_decay_rate_ = Scalar(0);     // 1 / tau
+  State current_state_;
+  State previous_state_;      // Before the last step() substep
   Trajectory trajectory_;
   double accumulator_ = 0.0;
-  Vec3 initial_position_;
+  double last_step_sec_ = 0.0;
+  double playback_t_ = 0.0;
+  State landing_state_;
+  bool result_available_ = false;
+  Phase phase_ = Phase::Rest;
+  State rest_state_;
+  bool rest_available_ = false;
+  Vec initial_position_;
+  long force_evaluations_ = 0;
+  
+  // RK45 state
+  Scalar adaptive_h_ = Scalar(0);
+  Derivative fsal_;         // Derivative at the current state (first-same-as-last)
+  bool fsal_valid_ = false;
+  long output_index_ = 0;   // Next dense-output sample is output_index_ * dt_fixed_sec
+  DenseStep last_dense_;    // Last accepted step, for drawing between steps
+  bool dense_valid_ = false;
 };
 
+// Runtime-configured engine: integrator and aero model follow PhysicsConfig.
+// Double precision; the reference for determinism tests.
+using PhysicsEngine = BasicPhysicsEngine<double, ConfiguredIntegrator, ConfiguredDrag, ConfiguredSpin>;
+
+// Fixed configurations (PhysicsConfig::integrator and aero_model ignored).
+// The float variants halve the state footprint for batch and embedded use.
+using SpinAwareRK4Engine = BasicPhysicsEngine<double, RK4Integrator, TabulatedDrag, MagnusSpin>;
+using SpinAwareRK4EngineF = BasicPhysicsEngine<float, RK4Integrator, TabulatedDrag, MagnusSpin>;
+using SpinAwareRK45Engine = BasicPhysicsEngine<double, RK45Integrator, TabulatedDrag, MagnusSpin>;
+using SimpleEulerEngine = BasicPhysicsEngine<double, EulerIntegrator, QuadraticDrag, NoSpin>;
+using SimpleEulerEngineF = BasicPhysicsEngine<float, EulerIntegrator, QuadraticDrag, NoSpin>;
+
+// Config for headless flights that only need the landing point (solver,
+// dispersion, landing table): adaptive RK45, no playback, no roll, minimal
+// trajectory storage. Aerodynamics, wind and air are kept.
+PhysicsConfig headlessLandingConfig(PhysicsConfig config);
+
+extern template class BasicPhysicsEngine<double, ConfiguredIntegrator, ConfiguredDrag, ConfiguredSpin>;
+extern template class BasicPhysicsEngine<double, RK4Integrator, TabulatedDrag, MagnusSpin>;
+extern template class BasicPhysicsEngine<float, RK4Integrator, TabulatedDrag, MagnusSpin>;
+extern template class BasicPhysicsEngine<double, RK45Integrator, TabulatedDrag, MagnusSpin>;
+extern template class BasicPhysicsEngine<double, EulerIntegrator, QuadraticDrag, NoSpin>;
+extern template class BasicPhysicsEngine<float, EulerIntegrator, QuadraticDrag, NoSpin>;
+
 } // namespace domain
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "domain/PhysicsConfig.hpp"
+
+namespace domain {
+
+// Compile-time policies for BasicPhysicsEngine. A fixed policy ignores the
+// matching PhysicsConfig field and folds to a constant, so the engine's
+// inner loop carries no model branches; the Configured* policies read the
+// field at runtime (the behaviour of the plain PhysicsEngine).
+
+// Integrator: which scheme advances the flight
+struct EulerIntegrator {
+  static constexpr PhysicsConfig::Integrator kind(const PhysicsConfig&) {
+    return PhysicsConfig::Integrator::Euler;
+  }
+};
+
+struct RK4Integrator {
+  static constexpr PhysicsConfig::Integrator kind(const PhysicsConfig&) {
+    return PhysicsConfig::Integrator::RK4;
+  }
+};
+
+struct RK45Integrator {
+  static constexpr PhysicsConfig::Integrator kind(const PhysicsConfig&) {
+    return PhysicsConfig::Integrator::RK45;
+  }
+};
+
+struct ConfiguredIntegrator {
+  static PhysicsConfig::Integrator kind(const PhysicsConfig& config) {
+    return config.integrator;
+  }
+};
+
+// DragModel: constant quadratic drag, or Cd from the Re x spin-ratio table
+struct QuadraticDrag {
+  static constexpr bool tabulated(const PhysicsConfig&) { return false; }
+};
+
+struct TabulatedDrag {
+  static constexpr bool tabulated(const PhysicsConfig&) { return true; }
+};
+
+struct ConfiguredDrag {
+  static bool tabulated(const PhysicsConfig& config) {
+    return config.aero_model == PhysicsConfig::AeroModel::SpinAware;
+  }
+};
+
+// SpinModel: spin ignored in flight, or Magnus lift plus spin decay
+struct NoSpin {
+  static constexpr bool magnus(const PhysicsConfig&) { return false; }
+};
+
+struct MagnusSpin {
+  static constexpr bool magnus(const PhysicsConfig&) { return true; }
+};
+
+struct ConfiguredSpin {
+  static bool magnus(const PhysicsConfig& config) {
+    return config.aero_model == PhysicsConfig::AeroModel::SpinAware;
+  }
+};
+
+} // namespace domain
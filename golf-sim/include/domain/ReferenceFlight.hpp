@@ -0,0 +1,166 @@
+#pragma once
+
+#include "domain/AeroCoefficients.hpp"
+#include "domain/BallState.hpp"
+#include "domain/ConstexprMath.hpp"
+#include "domain/PhysicsConfig.hpp"
+
+namespace domain {
+
+// Value object: summary of a reference flight
+struct ReferenceFlight {
+  double carry_m = 0.0;
+  double lateral_m = 0.0;
+  double flight_time_s = 0.0;
+  double apex_m = 0.0;
+};
+
+namespace reference_flight_detail {
+
+struct State {
+  double t = 0.0;
+  Vec3 pos;
+  Vec3 vel;
+  Vec3 spin;
+};
+
+struct Derivative {
+  Vec3 dvel;
+  Vec3 dspin;
+};
+
+struct Model {
+  const PhysicsConfig& config;
+  double drag_coefficient;
+  double aero_k;
+  double reynolds_per_speed;
+  double spin_decay_rate;
+  
+  constexpr Derivative evaluate(const State& s) const {
+    Vec3 accel(0.0, 0.0, -config.gravity);
+    Vec3 v_rel = s.vel - config.wind_velocity;
+    double v_rel_mag = v_rel.length();
+    if (v_rel_mag <= 1e-6) {
+      return Derivative{accel, Vec3()};
+    }
+    
+    if (config.aero_model == PhysicsConfig::AeroModel::Simple) {
+      accel = accel + v_rel.normalized() * (-drag_coefficient * v_rel_mag * v_rel_mag);
+      return Derivative{accel, Vec3()};
+    }
+    
+    double spin_mag = s.spin.length();
+    double omega = spin_mag * (2.0 * PI / 60.0);
+    AeroCoefficients c = lookupAeroCoefficients(v_rel_mag * reynolds_per_speed,
+                                                config.ball_radius_m * omega / v_rel_mag);
+    accel = accel + v_rel * (-aero_k * c.drag * v_rel_mag);
+    if (spin_mag > 1e-9) {
+      Vec3 axis = s.spin * (1.0 / spin_mag);
+      accel = accel + axis.cross(v_rel) * (aero_k * c.lift * v_rel_mag);
+    }
+    return Derivative{accel, s.spin * -spin_decay_rate};
+  }
+  
+  // One classic RK4 step (position derivative is the stage velocity)
+  constexpr State step(const State& s, double dt) const {
+    Derivative k1 = evaluate(s);
+    State s2 = shifted(s, s.vel, k1, 0.5 * dt);
+    Derivative k2 = evaluate(s2);
+    State s3 = shifted(s, s2.vel, k2, 0.5 * dt);
+    Derivative k3 = evaluate(s3);
+    State s4 = shifted(s, s3.vel, k3, dt);
+    Derivative k4 = evaluate(s4);
+    
+    State next = s;
+    next.pos = s.pos + (s.vel + (s2.vel + s3.vel) * 2.0 + s4.vel) * (dt / 6.0);
+    next.vel = s.vel + (k1.dvel + (k2.dvel + k3.dvel) * 2.0 + k4.dvel) * (dt / 6.0);
+    next.spin = s.spin + (k1.dspin + (k2.dspin + k3.dspin) * 2.0 + k4.dspin) * (dt / 6.0);
+    next.t = s.t + dt;
+    return next;
+  }
+  
+  static constexpr State shifted(const State& s, const Vec3& dpos, const Derivative& d, double dt) {
+    State r = s;
+    r.t = s.t + dt;
+    r.pos = s.pos + dpos * dt;
+    r.vel = s.vel + d.dvel * dt;
+    r.spin = s.spin + d.dspin * dt;
+    return r;
+  }
+};
+
+// Cubic Hermite position at t between two states one step apart
+constexpr Vec3 hermitePosition(const State& a, const State& b, double t) {
+  double h = b.t - a.t;
+  double u = h > 0.0 ? (t - a.t) / h : 0.0;
+  double u2 = u * u;
+  double u3 = u2 * u;
+  return a.pos * (2.0 * u3 - 3.0 * u2 + 1.0) + a.vel * ((u3 - 2.0 * u2 + u) * h)
+       + b.pos * (-2.0 * u3 + 3.0 * u2) + b.vel * ((u3 - u2) * h);
+}
+
+} // namespace reference_flight_detail
+
+// Reference flight from the origin to touchdown: classic RK4 at
+// config.dt_fixed_sec with config's aero model and wind, no ground phase.
+// Usable in constant expressions (static_assert, baked tables); at
+// runtime it reproduces PhysicsEngine with Integrator::RK4 exactly.
+constexpr ReferenceFlight simulateReferenceFlight(const PhysicsConfig& config,
+                                                  const LaunchCondition& launch) {
+  using namespace reference_flight_detail;
+  
+  double area = PI * config.ball_radius_m * config.ball_radius_m;
+  const Model model{config,
+                    config.dragCoefficient(),
+                    config.airDensity() * area / (2.0 * config.ball_mass_kg),
+                    2.0 * config.ball_radius_m / config.kinematicViscosity(),
+                    config.spin_decay_time_sec > 0.0 ? 1.0 / config.spin_decay_time_sec : 0.0};
+  
+  State s;
+  const Vec3& v = launch.initial_velocity;
+  if (v.x != 0.0 || v.y != 0.0 || v.z != 0.0) {
+    s.vel = v;
+  } else {
+    double angle_rad = launch.launch_angle_deg * PI / 180.0;
+    s.vel = Vec3(0.0,
+                 launch.launch_speed_mps * constexprCos(angle_rad),
+                 launch.launch_speed_mps * constexprSin(angle_rad));
+  }
+  s.spin = launch.initial_spin;
+  
+  ReferenceFlight flight;
+  while (s.t < config.max_flight_time_sec) {
+    State next = model.step(s, config.dt_fixed_sec);
+    if (next.pos.z <= 0.0 && next.t > 0.01) {
+      Vec3 pos = next.pos;
+      double t = next.t;
+      if (s.pos.z > 0.0) {
+        // Touchdown inside the step: bisect the interpolated height
+        double lo = s.t;
+        for (int i = 0; i < 60 && t - lo > 1e-12; ++i) {
+          double mid = 0.5 * (lo + t);
+          if (hermitePosition(s, next, mid).z > 0.0) {
+            lo = mid;
+          } else {
+            t = mid;
+          }
+        }
+        pos = hermitePosition(s, next, t);
+      }
+      flight.carry_m = Vec3(pos.x, pos.y, 0.0).length();
+      flight.lateral_m = pos.x;
+      flight.flight_time_s = t;
+      return flight;
+    }
+    s = next;
+    flight.apex_m = s.pos.z > flight.apex_m ? s.pos.z : flight.apex_m;
+  }
+  
+  // Safety cap reached
+  flight.carry_m = Vec3(s.pos.x, s.pos.y, 0.0).length();
+  flight.lateral_m = s.pos.x;
+  flight.flight_time_s = s.t;
+  return flight;
+}
+
+} // namespace domain
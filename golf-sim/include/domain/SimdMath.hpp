@@ -0,0 +1,340 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Header-only 4-lane float math for the domain kernels. The backend is
+// picked at compile time: SSE2 on x86-64, NEON on AArch64 (Pi 5), plain
+// scalar elsewhere or when GOLF_SIMD_FORCE_SCALAR is defined. add, sub,
+// mul, div and sqrt are IEEE-exact in every backend, so kernels built on
+// them match the equivalent scalar float code bit for bit; only the
+// rsqrt estimate differs between backends.
+#if !defined(GOLF_SIMD_FORCE_SCALAR) && (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#define GOLF_SIMD_SSE2 1
+#elif !defined(GOLF_SIMD_FORCE_SCALAR) && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define GOLF_SIMD_NEON 1
+#else
+#define GOLF_SIMD_SCALAR 1
+#endif
+
+namespace domain {
+namespace simd {
+
+// Each backend lives in its own inline namespace, so translation units
+// built with different backends can be linked together
+#if defined(GOLF_SIMD_SSE2)
+inline namespace sse2 {
+
+constexpr const char* BACKEND = "sse2";
+
+using F4 = __m128;
+using M4 = __m128;
+
+inline F4 load4(const float* p) { return _mm_loadu_ps(p); }
+inline void store4(float* p, F4 v) { _mm_storeu_ps(p, v); }
+inline F4 splat4(float v) { return _mm_set1_ps(v); }
+inline F4 add4(F4 a, F4 b) { return _mm_add_ps(a, b); }
+inline F4 sub4(F4 a, F4 b) { return _mm_sub_ps(a, b); }
+inline F4 mul4(F4 a, F4 b) { return _mm_mul_ps(a, b); }
+inline F4 sqrt4(F4 a) { return _mm_sqrt_ps(a); }
+inline F4 div4(F4 a, F4 b) { return _mm_div_ps(a, b); }
+inline F4 min4(F4 a, F4 b) { return _mm_min_ps(a, b); }
+inline F4 max4(F4 a, F4 b) { return _mm_max_ps(a, b); }
+inline F4 rsqrtEstimate4(F4 a) { return _mm_rsqrt_ps(a); }  // ~12 bits
+inline M4 loadMask(const uint32_t* p) {
+  return _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+}
+inline void storeMask(uint32_t* p, M4 m) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_castps_si128(m));
+}
+inline M4 splatMask(bool on) { return _mm_castsi128_ps(_mm_set1_epi32(on ? -1 : 0)); }
+inline M4 lessEqual(F4 a, F4 b) { return _mm_cmple_ps(a, b); }
+inline M4 less(F4 a, F4 b) { return _mm_cmplt_ps(a, b); }
+inline M4 greater(F4 a, F4 b) { return _mm_cmpgt_ps(a, b); }
+inline M4 both(M4 a, M4 b) { return _mm_and_ps(a, b); }
+inline M4 clearBits(M4 m, M4 clear) { return _mm_andnot_ps(clear, m); }
+inline F4 select4(M4 m, F4 a, F4 b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+inline bool any(M4 m) { return _mm_movemask_ps(m) != 0; }
+
+// a0 b0 c0 a1 b1 c1 a2 b2 c2 a3 b3 c3
+inline void storeInterleaved3(float* p, F4 a, F4 b, F4 c) {
+  F4 r0 = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 0, 0)),
+                         _mm_shuffle_ps(c, a, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+  F4 r1 = _mm_shuffle_ps(_mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 1, 1)),
+                         _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+  F4 r2 = _mm_shuffle_ps(_mm_shuffle_ps(c, a, _MM_SHUFFLE(3, 3, 2, 2)),
+                         _mm_shuffle_ps(b, c, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+  _mm_storeu_ps(p, r0);
+  _mm_storeu_ps(p + 4, r1);
+  _mm_storeu_ps(p + 8, r2);
+}
+
+#elif defined(GOLF_SIMD_NEON)
+inline namespace neon {
+
+constexpr const char* BACKEND = "neon";
+
+using F4 = float32x4_t;
+using M4 = uint32x4_t;
+
+inline F4 load4(const float* p) { return vld1q_f32(p); }
+inline void store4(float* p, F4 v) { vst1q_f32(p, v); }
+inline F4 splat4(float v) { return vdupq_n_f32(v); }
+inline F4 add4(F4 a, F4 b) { return vaddq_f32(a, b); }
+inline F4 sub4(F4 a, F4 b) { return vsubq_f32(a, b); }
+inline F4 mul4(F4 a, F4 b) { return vmulq_f32(a, b); }
+inline F4 sqrt4(F4 a) { return vsqrtq_f32(a); }
+inline F4 div4(F4 a, F4 b) { return vdivq_f32(a, b); }
+inline F4 min4(F4 a, F4 b) { return vminq_f32(a, b); }
+inline F4 max4(F4 a, F4 b) { return vmaxq_f32(a, b); }
+inline F4 rsqrtEstimate4(F4 a) { return vrsqrteq_f32(a); }  // ~8 bits
+inline M4 loadMask(const uint32_t* p) { return vld1q_u32(p); }
+inline void storeMask(uint32_t* p, M4 m) { vst1q_u32(p, m); }
+inline M4 splatMask(bool on) { return vdupq_n_u32(on ? 0xFFFFFFFFu : 0u); }
+inline M4 lessEqual(F4 a, F4 b) { return vcleq_f32(a, b); }
+inline M4 less(F4 a, F4 b) { return vcltq_f32(a, b); }
+inline M4 greater(F4 a, F4 b) { return vcgtq_f32(a, b); }
+inline M4 both(M4 a, M4 b) { return vandq_u32(a, b); }
+inline M4 clearBits(M4 m, M4 clear) { return vbicq_u32(m, clear); }
+inline F4 select4(M4 m, F4 a, F4 b) { return vbslq_f32(m, a, b); }
+inline bool any(M4 m) { return vmaxvq_u32(m) != 0; }
+
+inline void storeInterleaved3(float* p, F4 a, F4 b, F4 c) {
+  float32x4x3_t v = {{a, b, c}};
+  vst3q_f32(p, v);
+}
+
+#else
+inline namespace scalar {
+
+constexpr const char* BACKEND = "scalar";
+
+struct F4 { float v[4]; };
+struct M4 { uint32_t v[4]; };
+
+inline F4 load4(const float* p) { return F4{{p[0], p[1], p[2], p[3]}}; }
+inline void store4(float* p, F4 a) { for (int i = 0; i < 4; ++i) p[i] = a.v[i]; }
+inline F4 splat4(float x) { return F4{{x, x, x, x}}; }
+inline F4 add4(F4 a, F4 b) { for (int i = 0; i < 4; ++i) a.v[i] += b.v[i]; return a; }
+inline F4 sub4(F4 a, F4 b) { for (int i = 0; i < 4; ++i) a.v[i] -= b.v[i]; return a; }
+inline F4 mul4(F4 a, F4 b) { for (int i = 0; i < 4; ++i) a.v[i] *= b.v[i]; return a; }
+inline F4 sqrt4(F4 a) { for (int i = 0; i < 4; ++i) a.v[i] = std::sqrt(a.v[i]); return a; }
+inline F4 div4(F4 a, F4 b) { for (int i = 0; i < 4; ++i) a.v[i] /= b.v[i]; return a; }
+inline F4 min4(F4 a, F4 b) { for (int i = 0; i < 4; ++i) a.v[i] = std::min(a.v[i], b.v[i]); return a; }
+inline F4 max4(F4 a, F4 b) { for (int i = 0; i < 4; ++i) a.v[i] = std::max(a.v[i], b.v[i]); return a; }
+inline F4 rsqrtEstimate4(F4 a) { for (int i = 0; i < 4; ++i) a.v[i] = 1.0f / std::sqrt(a.v[i]); return a; }
+inline M4 loadMask(const uint32_t* p) { return M4{{p[0], p[1], p[2], p[3]}}; }
+inline void storeMask(uint32_t* p, M4 m) { for (int i = 0; i < 4; ++i) p[i] = m.v[i]; }
+inline M4 splatMask(bool on) { uint32_t b = on ? 0xFFFFFFFFu : 0u; return M4{{b, b, b, b}}; }
+inline M4 lessEqual(F4 a, F4 b) {
+  M4 m;
+  for (int i = 0; i < 4; ++i) m.v[i] = a.v[i] <= b.v[i] ? 0xFFFFFFFFu : 0u;
+  return m;
+}
+inline M4 less(F4 a, F4 b) {
+  M4 m;
+  for (int i = 0; i < 4; ++i) m.v[i] = a.v[i] < b.v[i] ? 0xFFFFFFFFu : 0u;
+  return m;
+}
+inline M4 greater(F4 a, F4 b) {
+  M4 m;
+  for (int i = 0; i < 4; ++i) m.v[i] = a.v[i] > b.v[i] ? 0xFFFFFFFFu : 0u;
+  return m;
+}
+inline M4 both(M4 a, M4 b) { for (int i = 0; i < 4; ++i) a.v[i] &= b.v[i]; return a; }
+inline M4 clearBits(M4 m, M4 clear) { for (int i = 0; i < 4; ++i) m.v[i] &= ~clear.v[i]; return m; }
+inline F4 select4(M4 m, F4 a, F4 b) {
+  for (int i = 0; i < 4; ++i) a.v[i] = m.v[i] ? a.v[i] : b.v[i];
+  return a;
+}
+inline bool any(M4 m) { return (m.v[0] | m.v[1] | m.v[2] | m.v[3]) != 0; }
+
+inline void storeInterleaved3(float* p, F4 a, F4 b, F4 c) {
+  for (int i = 0; i < 4; ++i) {
+    p[3 * i] = a.v[i];
+    p[3 * i + 1] = b.v[i];
+    p[3 * i + 2] = c.v[i];
+  }
+}
+
+#endif
+
+constexpr size_t LANES = 4;
+
+// 1 / sqrt(a): hardware estimate refined by Newton-Raphson (one step on
+// SSE2, two on NEON; relative error below 1e-6). The scalar backend divides
+// exactly. a = 0 gives +inf.
+inline F4 rsqrt4(F4 a) {
+#if defined(GOLF_SIMD_SCALAR)
+  return rsqrtEstimate4(a);
+#else
+  auto newton = [a](F4 y) {
+    return mul4(y, sub4(splat4(1.5f), mul4(mul4(splat4(0.5f), a), mul4(y, y))));
+  };
+  F4 estimate = rsqrtEstimate4(a);
+#if defined(GOLF_SIMD_NEON)
+  F4 y = newton(newton(estimate));  // NEON's estimate is coarser
+#else
+  F4 y = newton(estimate);
+#endif
+  return select4(greater(a, splat4(0.0f)), y, estimate);
+#endif
+}
+
+// Four Vec3s held as structure-of-arrays registers (one vector per lane)
+struct Vec3x4 {
+  F4 x, y, z;
+};
+
+inline Vec3x4 load3(const float* x, const float* y, const float* z) {
+  return Vec3x4{load4(x), load4(y), load4(z)};
+}
+
+inline void store3(float* x, float* y, float* z, const Vec3x4& v) {
+  store4(x, v.x);
+  store4(y, v.y);
+  store4(z, v.z);
+}
+
+inline Vec3x4 splat3(float x, float y, float z) {
+  return Vec3x4{splat4(x), splat4(y), splat4(z)};
+}
+
+inline Vec3x4 add(const Vec3x4& a, const Vec3x4& b) {
+  return Vec3x4{add4(a.x, b.x), add4(a.y, b.y), add4(a.z, b.z)};
+}
+
+inline Vec3x4 sub(const Vec3x4& a, const Vec3x4& b) {
+  return Vec3x4{sub4(a.x, b.x), sub4(a.y, b.y), sub4(a.z, b.z)};
+}
+
+inline Vec3x4 scale(const Vec3x4& a, F4 s) {
+  return Vec3x4{mul4(a.x, s), mul4(a.y, s), mul4(a.z, s)};
+}
+
+// Evaluated as (x * x + y * y) + z * z, like BasicVec3::dot
+inline F4 dot(const Vec3x4& a, const Vec3x4& b) {
+  return add4(add4(mul4(a.x, b.x), mul4(a.y, b.y)), mul4(a.z, b.z));
+}
+
+inline F4 length(const Vec3x4& a) {
+  return sqrt4(dot(a, a));
+}
+
+// Same rule as BasicVec3::normalized: vectors shorter than 1e-10 become 0
+inline Vec3x4 normalize(const Vec3x4& a) {
+  F4 len = length(a);
+  M4 tiny = less(len, splat4(1e-10f));
+  F4 zero = splat4(0.0f);
+  return Vec3x4{select4(tiny, zero, div4(a.x, len)),
+                select4(tiny, zero, div4(a.y, len)),
+                select4(tiny, zero, div4(a.z, len))};
+}
+
+// One xyzw vector per register (w = 0 for directions, 1 for points)
+struct Vec4 {
+  F4 v;
+};
+
+inline Vec4 loadVec4(const float* p) { return Vec4{load4(p)}; }
+inline void storeVec4(float* p, const Vec4& a) { store4(p, a.v); }
+inline Vec4 makeVec4(float x, float y, float z, float w) {
+  const float p[4] = {x, y, z, w};
+  return Vec4{load4(p)};
+}
+inline Vec4 add(const Vec4& a, const Vec4& b) { return Vec4{add4(a.v, b.v)}; }
+inline Vec4 sub(const Vec4& a, const Vec4& b) { return Vec4{sub4(a.v, b.v)}; }
+inline Vec4 mul(const Vec4& a, const Vec4& b) { return Vec4{mul4(a.v, b.v)}; }
+inline Vec4 scale(const Vec4& a, float s) { return Vec4{mul4(a.v, splat4(s))}; }
+
+// Batch kernels over float columns. Any count: the tail is padded into a
+// temporary group, so every element goes through the same lane code.
+namespace detail {
+
+template <typename Kernel>
+inline void forEachGroup(size_t count, const Kernel& kernel) {
+  size_t full = count / LANES * LANES;
+  for (size_t i = 0; i < full; i += LANES) {
+    kernel(i, LANES);
+  }
+  if (full < count) {
+    kernel(full, count - full);
+  }
+}
+
+// Copies up to 4 floats into a padded group (padding lanes = fill)
+inline F4 loadPartial(const float* p, size_t n, float fill) {
+  float tmp[LANES] = {fill, fill, fill, fill};
+  std::copy(p, p + n, tmp);
+  return load4(tmp);
+}
+
+inline void storePartial(float* p, size_t n, F4 v) {
+  float tmp[LANES];
+  store4(tmp, v);
+  std::copy(tmp, tmp + n, p);
+}
+
+} // namespace detail
+
+// In place: each (x, y, z) row scaled to unit length (or zeroed)
+inline void normalizeBatch(float* x, float* y, float* z, size_t count) {
+  detail::forEachGroup(count, [&](size_t i, size_t n) {
+    if (n == LANES) {
+      store3(x + i, y + i, z + i, normalize(load3(x + i, y + i, z + i)));
+      return;
+    }
+    Vec3x4 v{detail::loadPartial(x + i, n, 0.0f), detail::loadPartial(y + i, n, 0.0f),
+             detail::loadPartial(z + i, n, 0.0f)};
+    v = normalize(v);
+    detail::storePartial(x + i, n, v.x);
+    detail::storePartial(y + i, n, v.y);
+    detail::storePartial(z + i, n, v.z);
+  });
+}
+
+// out[i] = 1 / |(x, y, z)[i]| via rsqrt4 (approximate, see above)
+inline void reciprocalLengthBatch(const float* x, const float* y, const float* z,
+                                  float* out, size_t count) {
+  detail::forEachGroup(count, [&](size_t i, size_t n) {
+    Vec3x4 v = n == LANES
+      ? load3(x + i, y + i, z + i)
+      : Vec3x4{detail::loadPartial(x + i, n, 1.0f), detail::loadPartial(y + i, n, 0.0f),
+               detail::loadPartial(z + i, n, 0.0f)};
+    F4 r = rsqrt4(dot(v, v));
+    if (n == LANES) {
+      store4(out + i, r);
+    } else {
+      detail::storePartial(out + i, n, r);
+    }
+  });
+}
+
+// Columns to packed xyz triples (out holds 3 * count floats), translated by
+// (dx, dy, dz) on the way
+inline void interleaveTranslated(const float* x, const float* y, const float* z,
+                                 float dx, float dy, float dz, float* out, size_t count) {
+  const F4 ox = splat4(dx);
+  const F4 oy = splat4(dy);
+  const F4 oz = splat4(dz);
+  detail::forEachGroup(count, [&](size_t i, size_t n) {
+    if (n == LANES) {
+      storeInterleaved3(out + 3 * i, add4(load4(x + i), ox), add4(load4(y + i), oy),
+                        add4(load4(z + i), oz));
+      return;
+    }
+    float tmp[3 * LANES];
+    storeInterleaved3(tmp, add4(detail::loadPartial(x + i, n, 0.0f), ox),
+                      add4(detail::loadPartial(y + i, n, 0.0f), oy),
+                      add4(detail::loadPartial(z + i, n, 0.0f), oz));
+    std::copy(tmp, tmp + 3 * n, out + 3 * i);
+  });
+}
+
+} // inline namespace
+} // namespace simd
+} // namespace domain
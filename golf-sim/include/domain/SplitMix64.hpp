@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+namespace domain {
+
+// SplitMix64: tiny, seedable, identical on every platform. Advances
+// `state` and returns the next 64 random bits. The one generator behind
+// the hole's gust noise and the dispersion streams.
+inline uint64_t splitMix64(uint64_t& state) {
+  uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+} // namespace domain
@@ -1,26 +1,71 @@
 #pragma once
 
 #include "domain/BallState.hpp"
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace domain {
 
 // Pure domain entity for a trajectory (collection of states)
+//
+// Storage is a fixed-capacity structure-of-arrays of floats, allocated once
+// in the constructor and reused across shots. When the point budget is
+// exhausted the recorded points are decimated 2:1 and further points are
+// kept at twice the previous stride. Keyframes (e.g. landing), the apex and
+// the most recent point are never dropped, so those samples stay exact.
 class Trajectory {
 public:
-  Trajectory() = default;
+  static constexpr size_t DEFAULT_CAPACITY = 2000;  // Design doc: max_trail_points
+  static constexpr size_t MIN_CAPACITY = 8;
   
-  void addPoint(const BallState& state);
+  explicit Trajectory(size_t capacity = DEFAULT_CAPACITY);
+  
+  void addPoint(const BallState& state, bool keyframe = false);
   void clear();
   
-  const std::vector<BallState>& getPoints() const { return points_; }
-  size_t size() const { return points_.size(); }
-  bool empty() const { return points_.empty(); }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  size_t capacity() const { return capacity_; }
+  
+  BallState getPoint(size_t index) const;
+  BallState getLastPoint() const;
+  
+  // Index of the highest recorded point
+  size_t getApexIndex() const { return apex_index_; }
+  
+  // Number of incoming points per stored point (doubles on each decimation)
+  size_t getStride() const { return stride_; }
   
-  const BallState& getLastPoint() const;
+  // Linearly interpolated state at time t (clamped to the recorded range)
+  BallState sampleAt(double t_sec) const;
+  
+  // Raw column access (size() elements each)
+  const float* times() const { return t_.data(); }
+  const float* xs() const { return x_.data(); }
+  const float* ys() const { return y_.data(); }
+  const float* zs() const { return z_.data(); }
   
 private:
-  std::vector<BallState> points_;
+  enum Flags : uint8_t {
+    IN_FLIGHT = 1 << 0,
+    KEYFRAME = 1 << 1,
+    PROVISIONAL = 1 << 2  // Off-stride point kept only while it is the newest
+  };
+  
+  void store(const BallState& state, uint8_t flags);
+  void decimate();
+  
+  size_t capacity_;
+  size_t size_ = 0;
+  size_t stride_ = 1;
+  size_t offered_ = 0;
+  size_t apex_index_ = 0;
+  
+  std::vector<float> t_;
+  std::vector<float> x_, y_, z_;
+  std::vector<float> vx_, vy_, vz_;
+  std::vector<uint8_t> flags_;
 };
 
 } // namespace domain
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "domain/Trajectory.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace domain {
+
+// Canonical fingerprint of a flight: FNV-1a over every recorded state
+// (time, position, velocity, in-flight flag) in order, plus the count.
+//
+// quantum == 0 hashes the stored float samples bit for bit, so any change
+// in rounding anywhere in the pipeline (integrator, compiler flags, fused
+// multiply-adds, reordered sums) changes the hash. quantum > 0 rounds each
+// value to the nearest multiple of quantum first, which hides noise below
+// that size (values near a rounding boundary can still flip).
+uint64_t hashTrajectory(const Trajectory& trajectory, double quantum = 0.0);
+
+// Tolerance mode: largest per-sample deviation between two trajectories
+struct TrajectoryDifference {
+  bool same_length = false;
+  size_t compared = 0;             // Samples compared (shorter length)
+  double max_time_s = 0.0;
+  double max_position_m = 0.0;
+  double max_velocity_mps = 0.0;
+  
+  bool within(double position_m, double velocity_mps) const {
+    return same_length && max_position_m <= position_m && max_velocity_mps <= velocity_mps;
+  }
+};
+
+TrajectoryDifference compareTrajectories(const Trajectory& a, const Trajectory& b);
+
+} // namespace domain
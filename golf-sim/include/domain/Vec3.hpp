@@ -1,29 +1,60 @@
 #pragma once
 
+#include "domain/ConstexprMath.hpp"
+
 namespace domain {
 
-struct Vec3 {
-  double x = 0.0;
-  double y = 0.0;
-  double z = 0.0;
+// 3-vector over a scalar type; Vec3 (double) is the reference precision,
+// Vec3f backs the single-precision physics instantiations. Fully inline and
+// constexpr (length() forwards to std::sqrt at runtime).
+template <typename T>
+struct BasicVec3 {
+  T x = T(0);
+  T y = T(0);
+  T z = T(0);
+  
+  constexpr BasicVec3() = default;
+  constexpr BasicVec3(T x_, T y_, T z_) : x(x_), y(y_), z(z_) {}
+  
+  // Precision conversion
+  template <typename U>
+  constexpr explicit BasicVec3(const BasicVec3<U>& other)
+    : x(static_cast<T>(other.x)), y(static_cast<T>(other.y)), z(static_cast<T>(other.z)) {}
+  
+  constexpr BasicVec3 operator+(const BasicVec3& other) const {
+    return BasicVec3(x + other.x, y + other.y, z + other.z);
+  }
   
-  Vec3() = default;
-  Vec3(double x_, double y_, double z_) : x(x_), y(y_), z(z_) {}
+  constexpr BasicVec3 operator-(const BasicVec3& other) const {
+    return BasicVec3(x - other.x, y - other.y, z - other.z);
+  }
+  
+  constexpr BasicVec3 operator*(T scalar) const {
+    return BasicVec3(x * scalar, y * scalar, z * scalar);
+  }
   
-  Vec3 operator+(const Vec3& other) const {
-    return Vec3(x + other.x, y + other.y, z + other.z);
+  constexpr T dot(const BasicVec3& other) const {
+    return x * other.x + y * other.y + z * other.z;
   }
   
-  Vec3 operator-(const Vec3& other) const {
-    return Vec3(x - other.x, y - other.y, z - other.z);
+  constexpr BasicVec3 cross(const BasicVec3& other) const {
+    return BasicVec3(y * other.z - z * other.y,
+                     z * other.x - x * other.z,
+                     x * other.y - y * other.x);
   }
   
-  Vec3 operator*(double scalar) const {
-    return Vec3(x * scalar, y * scalar, z * scalar);
+  constexpr T length() const {
+    return constexprSqrt(x * x + y * y + z * z);
   }
   
-  double length() const;
-  Vec3 normalized() const;
+  constexpr BasicVec3 normalized() const {
+    T len = length();
+    if (len < T(1e-10)) return BasicVec3(0, 0, 0);
+    return BasicVec3(x / len, y / len, z / len);
+  }
 };
 
+using Vec3 = BasicVec3<double>;
+using Vec3f = BasicVec3<float>;
+
 } // namespace domain
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "domain/Vec3.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace domain {
+
+// Pure value object describing a hole's wind
+struct WindFieldConfig {
+  double speed_mps = 0.0;             // Mean speed at reference_height_m
+  double direction_deg = 90.0;        // Blowing toward; CCW from +x (90 = tailwind)
+  double reference_height_m = 10.0;   // Anemometer height
+  double roughness_length_m = 0.03;   // z0 of mown grass
+  
+  // Gusts: seeded value noise over time, relative to the mean speed.
+  // They travel downwind at the mean speed (frozen turbulence), so a gust
+  // reaches the green later than the tee.
+  double gust_intensity = 0.25;       // Along-wind amplitude / mean speed
+  double gust_lateral_ratio = 0.5;    // Cross-wind amplitude / along-wind
+  double gust_period_sec = 3.0;       // Spacing of the noise knots
+  uint64_t seed = 1;
+  
+  // Sampling grid over height x downrange x time. Time wraps after
+  // duration_sec; positions outside the grid clamp to its edge.
+  double max_height_m = 64.0;
+  double height_step_m = 2.0;
+  double min_downrange_m = -40.0;
+  double max_downrange_m = 400.0;
+  double downrange_step_m = 20.0;
+  double duration_sec = 32.0;
+  double time_step_sec = 0.5;
+};
+
+// Pure domain service: a spatially and temporally varying wind.
+//
+// The mean wind follows the logarithmic boundary-layer profile
+// u(z) = u_ref * ln(1 + z / z0) / ln(1 + z_ref / z0). All noise is
+// evaluated once in the constructor onto a (height, downrange, time) grid
+// of float pairs; sample() is a trilinear blend of eight nodes, so per-step
+// lookups from the physics engine stay O(1). The wind is horizontal and
+// uniform across the fairway (x). Deterministic for a given config.
+class WindField {
+public:
+  explicit WindField(const WindFieldConfig& config);
+  
+  // Wind at a world position (x lateral, y downrange, z up) and time
+  Vec3 sample(const Vec3& pos, double t_sec) const;
+  
+  // Gust-free wind at height z
+  Vec3 meanWind(double z) const;
+  
+  // u(z) / u_ref of the log profile (0 at and below the ground)
+  double profileFactor(double z) const;
+  
+  const WindFieldConfig& config() const { return config_; }
+  size_t nodeCount() const { return nodes_.size() / 2; }
+
+private:
+  size_t nodeIndex(size_t iz, size_t iy, size_t it) const {
+    return ((it * ny_ + iy) * nz_ + iz) * 2;
+  }
+  
+  WindFieldConfig config_;
+  Vec3 along_;     // Unit vector the wind blows toward
+  Vec3 across_;    // along_ rotated 90 degrees CCW
+  double profile_norm_ = 0.0;
+  double dz_ = 0.0;  // Effective grid steps
+  double dy_ = 0.0;
+  double dt_ = 0.0;
+  size_t nz_ = 0;
+  size_t ny_ = 0;
+  size_t nt_ = 0;
+  std::vector<float> nodes_;  // (x, y) per node; z fastest, then y, then t
+};
+
+} // namespace domain
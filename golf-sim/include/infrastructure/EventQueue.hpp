@@ -0,0 +1,137 @@
+#pragma once
+
+#include "infrastructure/ISensorProvider.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace infrastructure {
+
+// Internal event passed from input to the game loop
+struct Event {
+  enum class Type : uint32_t {
+    Pose,        // IMU sample / pose update
+    SwingStart,  // Swing detected
+    Impact,      // Impact detected
+    SwingEnd     // Swing finished
+  };
+  
+  Type type = Type::Pose;
+  double t_sec = 0.0;
+  SensorFrame frame;
+};
+
+// Lock-free single-producer/single-consumer ring of Events.
+//
+// Capacity is rounded up to a power of two. When the ring is full,
+// DropOldest (the default) discards the oldest unread event so the newest
+// always gets in; Reject refuses the new one instead. push() is wait-free;
+// pop() only retries when the producer dropped the event it was reading.
+//
+// Slots are stored as relaxed atomic words, so a producer overwriting a
+// slot the consumer is still copying is not a data race: the consumer
+// notices the drop when its claim on the read index fails and takes the
+// next event. On x86-64 and AArch64 the word copies are plain moves.
+class EventQueue {
+public:
+  enum class OverflowPolicy {
+    DropOldest,  // Keep the newest events (input latency over completeness)
+    Reject       // Keep the oldest; push() returns false when full
+  };
+  
+  explicit EventQueue(size_t capacity = 1024, OverflowPolicy policy = OverflowPolicy::DropOldest);
+  EventQueue(const EventQueue&) = delete;
+  EventQueue& operator=(const EventQueue&) = delete;
+  
+  // Producer side. False only if the event was rejected.
+  bool push(const Event& e) {
+    uint64_t w = write_.load(std::memory_order_relaxed);
+    uint64_t r = read_.load(std::memory_order_acquire);
+    if (w - r >= capacity_) {
+      if (policy_ == OverflowPolicy::Reject) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      // Advance the consumer past the oldest event. If the consumer beat
+      // us to it, a slot has just been freed either way.
+      if (read_.compare_exchange_strong(r, r + 1, std::memory_order_acq_rel)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+    
+    uint64_t words[WORDS];
+    std::memcpy(words, &e, sizeof(Event));
+    Slot& slot = slots_[w & mask_];
+    for (size_t i = 0; i < WORDS; ++i) {
+      slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    write_.store(w + 1, std::memory_order_release);
+    
+    uint64_t depth = w + 1 - read_.load(std::memory_order_relaxed);
+    if (depth > high_water_.load(std::memory_order_relaxed)) {
+      high_water_.store(depth, std::memory_order_relaxed);
+    }
+    return true;
+  }
+  
+  // Consumer side. False if the queue is empty.
+  bool pop(Event& out) {
+    uint64_t r = read_.load(std::memory_order_acquire);
+    for (;;) {
+      if (r == write_.load(std::memory_order_acquire)) {
+        return false;
+      }
+      uint64_t words[WORDS];
+      const Slot& slot = slots_[r & mask_];
+      for (size_t i = 0; i < WORDS; ++i) {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+      }
+      // Claim the event; fails (reloading r) if the producer dropped it
+      // while we were copying
+      if (read_.compare_exchange_strong(r, r + 1, std::memory_order_acq_rel)) {
+        std::memcpy(&out, words, sizeof(Event));
+        return true;
+      }
+    }
+  }
+  
+  // Events waiting (approximate while the other side is running)
+  size_t size() const {
+    uint64_t r = read_.load(std::memory_order_acquire);
+    uint64_t w = write_.load(std::memory_order_acquire);
+    return w > r ? static_cast<size_t>(w - r) : 0;
+  }
+  size_t capacity() const { return static_cast<size_t>(capacity_); }
+  OverflowPolicy policy() const { return policy_; }
+  
+  // Metrics (HUD and logs)
+  size_t dropped() const { return static_cast<size_t>(dropped_.load(std::memory_order_relaxed)); }
+  size_t highWaterMark() const { return static_cast<size_t>(high_water_.load(std::memory_order_relaxed)); }
+  uint64_t pushed() const { return write_.load(std::memory_order_relaxed); }
+
+private:
+  static_assert(std::is_trivially_copyable<Event>::value, "Event is copied as raw words");
+  static constexpr size_t WORDS = (sizeof(Event) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  static_assert(WORDS * sizeof(uint64_t) == sizeof(Event), "Event must fill whole words");
+  
+  struct Slot {
+    std::atomic<uint64_t> words[WORDS];
+  };
+  
+  uint64_t capacity_;
+  uint64_t mask_;
+  OverflowPolicy policy_;
+  std::unique_ptr<Slot[]> slots_;
+  
+  // Producer-written counters and the shared read index on their own
+  // cache lines, away from the read-mostly fields above
+  alignas(64) std::atomic<uint64_t> write_{0};
+  std::atomic<uint64_t> high_water_{0};
+  std::atomic<uint64_t> dropped_{0};
+  alignas(64) std::atomic<uint64_t> read_{0};
+};
+
+} // namespace infrastructure
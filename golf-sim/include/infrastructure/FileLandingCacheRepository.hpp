@@ -0,0 +1,22 @@
+#pragma once
+
+#include "application/LandingCacheRepository.hpp"
+#include <string>
+
+namespace infrastructure {
+
+// Cache file: fixed header (magic, version, key, count) followed by raw
+// floats. Loading maps the file read-only, so the table is used in place
+// without copying or parsing.
+class FileLandingCacheRepository : public application::LandingCacheRepository {
+public:
+  explicit FileLandingCacheRepository(std::string path);
+  
+  std::unique_ptr<application::CachedFloats> load(uint64_t key) const override;
+  bool save(uint64_t key, const float* data, size_t count) override;
+  
+private:
+  std::string path_;
+};
+
+} // namespace infrastructure
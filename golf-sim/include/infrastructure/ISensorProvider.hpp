@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace infrastructure {
 
 // Raw sensor data frame
@@ -25,6 +27,18 @@ public:
   // Non-blocking poll: returns true if data available
   virtual bool poll(SensorFrame& out) = 0;
   
+  // Non-blocking batch poll into caller-owned storage: writes up to
+  // `capacity` available frames, oldest first, and returns the count.
+  // The default calls poll() per frame; providers holding buffered data
+  // override it so a batch costs one virtual call.
+  virtual size_t pollBatch(SensorFrame* out, size_t capacity) {
+    size_t count = 0;
+    while (count < capacity && poll(out[count])) {
+      ++count;
+    }
+    return count;
+  }
+  
   // Reset provider state
   virtual void reset() = 0;
 };
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "infrastructure/EventQueue.hpp"
+#include "infrastructure/ISensorProvider.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace infrastructure {
+
+struct InputThreadConfig {
+  double poll_rate_hz = 2000.0;  // Wake-ups per second; every wake-up drains the provider
+  bool restamp_frames = true;    // Map provider timestamps onto CLOCK_MONOTONIC
+};
+
+// Measured behaviour of the input thread since start()
+struct InputThreadStats {
+  uint64_t wakeups = 0;
+  uint64_t frames = 0;            // Frames read from the provider
+  uint64_t overruns = 0;          // Wake-ups that ran past the next deadline
+  uint64_t missed_periods = 0;    // Deadlines skipped because of overruns
+  double elapsed_sec = 0.0;
+  double poll_rate_hz = 0.0;      // Measured wake-ups per second
+  double frame_rate_hz = 0.0;     // Measured frames per second
+  double mean_jitter_us = 0.0;    // Wake-up lateness behind the deadline
+  double max_jitter_us = 0.0;
+};
+
+// Polls an ISensorProvider at a fixed rate on a thread of its own and
+// pushes every frame into an EventQueue as a Pose event, so the game loop
+// only drains the queue and a slow frame never stalls sampling.
+//
+// Deadlines are absolute on CLOCK_MONOTONIC (clock_nanosleep with
+// TIMER_ABSTIME), so the rate does not drift with the time spent polling.
+// A wake-up that runs past the next deadline counts as an overrun and the
+// missed deadlines are skipped rather than replayed back to back.
+//
+// Restamping keeps the provider's spacing between frames: provider time is
+// shifted by an offset that puts the first batch's newest frame at its
+// arrival. The offset is taken again whenever a batch would land in the
+// future (a lower latency than seen so far, or a provider clock running
+// fast) or provider time fails to advance between batches (provider
+// restarted); stamps never go backwards.
+//
+// The provider must only be polled by this object; the queue's producer
+// side belongs to it too.
+class InputThread {
+public:
+  InputThread(ISensorProvider& provider, EventQueue& queue,
+              const InputThreadConfig& config = InputThreadConfig());
+  ~InputThread();
+  
+  InputThread(const InputThread&) = delete;
+  InputThread& operator=(const InputThread&) = delete;
+  
+  void start();
+  void stop();
+  bool isRunning() const { return running_.load(std::memory_order_relaxed); }
+  
+  // Drain the provider once on the calling thread (not while running).
+  // Returns the number of frames pushed.
+  size_t pollOnce();
+  
+  // Any thread
+  InputThreadStats stats() const;
+  
+  // Seconds on CLOCK_MONOTONIC, the time base of restamped frames
+  static double monotonicNowSec();
+
+private:
+  static constexpr size_t BATCH_FRAMES = 64;  // Frames per pollBatch() call
+  
+  void run();
+  
+  ISensorProvider& provider_;
+  EventQueue& queue_;
+  InputThreadConfig config_;
+  SensorFrame batch_[BATCH_FRAMES];
+  
+  // Restamping: monotonic time = provider time + stamp_offset_sec_
+  bool stamp_anchored_ = false;
+  double stamp_offset_sec_ = 0.0;
+  double last_provider_sec_ = 0.0;
+  double last_stamp_sec_ = 0.0;
+  
+  std::thread thread_;
+  std::atomic<bool> running_{false};
+  std::atomic<int64_t> start_ns_{0};
+  std::atomic<int64_t> stop_ns_{0};  // 0 while running
+  std::atomic<uint64_t> wakeups_{0};
+  std::atomic<uint64_t> frames_{0};
+  std::atomic<uint64_t> overruns_{0};
+  std::atomic<uint64_t> missed_periods_{0};
+  std::atomic<int64_t> jitter_sum_ns_{0};
+  std::atomic<int64_t> jitter_max_ns_{0};
+};
+
+} // namespace infrastructure
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "infrastructure/ISensorProvider.hpp"
+#include <atomic>
+#include <cstdint>
 #include <random>
 
 namespace infrastructure {
@@ -20,19 +22,32 @@ public:
   explicit MockSensorProvider(Scenario scenario = Scenario::Basic, unsigned int seed = 42);
   
   bool poll(SensorFrame& out) override;
+  size_t pollBatch(SensorFrame* out, size_t capacity) override;
   void reset() override;
   
-  // Trigger impact event (for testing)
+  // Trigger impact event (for testing). May be called from a thread other
+  // than the one polling.
   void triggerImpact(double speed_mps, double angle_deg);
   
+  // Queue `count` at-rest pose frames 1 ms apart (load and batching
+  // tests). Call from the polling thread or before polling starts.
+  void streamFrames(uint64_t count);
+  
+  // Spin axis tilt produced by the scenario's swing (+ slice, - hook)
+  double getSpinAxisDeg() const;
+  
 private:
+  void makeImpactFrame(SensorFrame& out);
+  void makeRestFrame(SensorFrame& out);
+  
   Scenario scenario_;
   std::mt19937 rng_;
   double current_time_;
-  bool impact_triggered_;
+  std::atomic<bool> impact_triggered_;
   double impact_speed_;
   double impact_angle_;
   int poll_count_;
+  uint64_t pending_stream_frames_ = 0;
 };
 
 } // namespace infrastructure
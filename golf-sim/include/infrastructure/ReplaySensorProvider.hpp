@@ -0,0 +1,86 @@
+#pragma once
+
+#include "infrastructure/ISensorProvider.hpp"
+#include "infrastructure/TraceCsv.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace infrastructure {
+
+// Replays a recorded trace (TraceCsv rows) as sensor frames.
+//
+// The file is memory-mapped read-only and rows are parsed in place as
+// they are polled: opening is O(1) whatever the trace length, and nothing
+// is copied or allocated per row. Rows must be in time order; seek()
+// bisects the mapped bytes, so finding a timestamp costs O(log n) row
+// parses. Malformed rows are skipped and counted, never fatal. Only Pose
+// rows become frames; detector rows (SwingStart, Impact, ...) are counted
+// and skipped, since replay feeds them through detection again.
+//
+// Sync mode hands out each frame once its trace time has elapsed on the
+// steady clock since the first poll (or seek); Fast mode hands out
+// everything immediately, for regression runs.
+class ReplaySensorProvider : public ISensorProvider {
+public:
+  enum class Mode {
+    Sync,  // Real time
+    Fast   // As fast as polled
+  };
+  
+  explicit ReplaySensorProvider(const std::string& path, Mode mode = Mode::Sync);
+  ~ReplaySensorProvider() override;
+  
+  ReplaySensorProvider(const ReplaySensorProvider&) = delete;
+  ReplaySensorProvider& operator=(const ReplaySensorProvider&) = delete;
+  
+  // False if the file could not be mapped (poll() then never has data)
+  bool isOpen() const { return data_ != nullptr; }
+  
+  bool poll(SensorFrame& out) override;
+  size_t pollBatch(SensorFrame* out, size_t capacity) override;
+  
+  // Back to the first row; counters cleared, sync clock restarts
+  void reset() override;
+  
+  // Continue from the first frame with t_sec >= t_sec (sync clock restarts)
+  void seek(double t_sec);
+  
+  bool finished() const;
+  Mode mode() const { return mode_; }
+  size_t sizeBytes() const { return size_; }
+  
+  uint64_t framesDelivered() const { return frames_delivered_; }
+  uint64_t corruptRows() const { return corrupt_rows_; }
+  uint64_t annotationRows() const { return annotation_rows_; }  // Non-Pose rows skipped
+
+private:
+  // Next Pose row at or after `offset`; on success `offset` is past it.
+  // Skipped rows are added to the counters that are given.
+  bool nextFrame(size_t& offset, SensorFrame& out,
+                 uint64_t* corrupt = nullptr, uint64_t* annotations = nullptr) const;
+  size_t lineStartAtOrAfter(size_t offset) const;
+  bool nextDue(SensorFrame& out);
+  
+  Mode mode_;
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  size_t first_row_ = 0;  // Past the header line, if any
+  size_t cursor_ = 0;
+  
+  // Row parsed ahead of time in sync mode, waiting for its time to come
+  bool has_pending_ = false;
+  SensorFrame pending_;
+  size_t pending_next_ = 0;
+  
+  bool anchored_ = false;
+  std::chrono::steady_clock::time_point wall_anchor_;
+  double trace_anchor_ = 0.0;
+  
+  uint64_t frames_delivered_ = 0;
+  uint64_t corrupt_rows_ = 0;
+  uint64_t annotation_rows_ = 0;
+};
+
+} // namespace infrastructure
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "infrastructure/EventQueue.hpp"
+#include <cstddef>
+
+namespace infrastructure {
+
+// Replay trace rows, one per line (design doc 14.1):
+//   t,type,ax,ay,az,gx,gy,gz
+//   0.000,Pose,0.01,0.02,9.80,0.001,0.002,0.003
+// Pose rows are raw sensor samples; the other types mark detector output.
+constexpr const char* TRACE_CSV_HEADER = "t,type,ax,ay,az,gx,gy,gz";
+constexpr size_t TRACE_CSV_MAX_ROW = 192;  // Longest formatted row, newline included
+
+const char* eventTypeName(Event::Type type);
+bool parseEventType(const char* begin, const char* end, Event::Type& out);
+
+// Writes one row and its newline to out (at least TRACE_CSV_MAX_ROW
+// bytes) and returns its length. Numbers use the shortest form that parses
+// back to the same value, so parseTraceRow() restores the event exactly.
+size_t formatTraceRow(const Event& event, char* out);
+
+// Parses one row in [begin, end) (line break excluded; a trailing '\r' is
+// allowed) straight from the caller's buffer. False if malformed.
+// out.frame.t_sec is set to out.t_sec.
+bool parseTraceRow(const char* begin, const char* end, Event& out);
+
+} // namespace infrastructure
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "infrastructure/EventQueue.hpp"
+#include "infrastructure/TraceCsv.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace infrastructure {
+
+struct TraceRecorderConfig {
+  size_t buffer_records = 8192;  // Per buffer; two are allocated up front
+};
+
+struct TraceRecorderStats {
+  uint64_t recorded = 0;        // Accepted by record()
+  uint64_t written = 0;         // On disk
+  uint64_t dropped = 0;         // Refused: both buffers full
+  uint64_t backpressure = 0;    // Times the writer fell behind (drop episodes)
+  uint64_t flushes = 0;         // Buffers written
+  uint64_t bytes_written = 0;
+  bool write_error = false;
+};
+
+// Records frames and events to a trace file ReplaySensorProvider can play
+// (TraceCsv rows) without doing I/O on the caller's thread.
+//
+// record() copies into the active one of two preallocated buffers. When it
+// fills, the buffer is handed to a background thread that formats it and
+// writes it with one large sequential write, while recording continues in
+// the other. If the writer still holds that buffer when it fills too, new
+// records are dropped and counted rather than stalling the caller.
+//
+// record() and flush() belong to a single producer thread.
+class TraceRecorder {
+public:
+  explicit TraceRecorder(const std::string& path,
+                         const TraceRecorderConfig& config = TraceRecorderConfig());
+  ~TraceRecorder();
+  
+  TraceRecorder(const TraceRecorder&) = delete;
+  TraceRecorder& operator=(const TraceRecorder&) = delete;
+  
+  // False if the file could not be created (records are then discarded)
+  bool isOpen() const { return fd_ >= 0; }
+  
+  void start();
+  // Writes everything recorded so far, then ends the writer thread
+  void stop();
+  bool isRunning() const { return running_.load(std::memory_order_relaxed); }
+  
+  // Producer side; never waits for I/O. False if the record was dropped.
+  bool record(const SensorFrame& frame);  // As a Pose row
+  bool record(const Event& event);
+  
+  // Producer side: hand over the partial buffer and wait until it is written
+  void flush();
+  
+  // Any thread
+  TraceRecorderStats stats() const;
+
+private:
+  bool handOff();
+  void waitForWriter();
+  void run();
+  void writeOut(size_t index, size_t count);
+  
+  int fd_ = -1;
+  TraceRecorderConfig config_;
+  std::vector<Event> buffers_[2];
+  
+  // Producer state
+  size_t active_ = 0;
+  size_t fill_ = 0;
+  bool stalled_ = false;
+  
+  // Hand-off to the writer: set by handOff(), cleared once written
+  std::atomic<bool> writer_busy_{false};
+  std::mutex mutex_;
+  std::condition_variable wake_writer_;
+  std::condition_variable written_;
+  bool pending_ = false;
+  size_t pending_index_ = 0;
+  size_t pending_count_ = 0;
+  bool stopping_ = false;
+  
+  std::vector<char> text_;  // Writer's formatting buffer
+  std::thread thread_;
+  std::atomic<bool> running_{false};
+  
+  std::atomic<uint64_t> recorded_{0};
+  std::atomic<uint64_t> written_records_{0};
+  std::atomic<uint64_t> dropped_{0};
+  std::atomic<uint64_t> backpressure_{0};
+  std::atomic<uint64_t> flushes_{0};
+  std::atomic<uint64_t> bytes_written_{0};
+  std::atomic<bool> write_error_{false};
+};
+
+} // namespace infrastructure
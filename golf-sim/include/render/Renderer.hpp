@@ -22,6 +22,9 @@ struct GreenData {
   BallPosition current_ball_pos;  // Current ball position
   float carry_distance = 0.0f;
   float lateral_distance = 0.0f;
+  std::vector<TrajectoryPoint> predicted_arc;  // Preview while aiming
+  std::vector<BallPosition> dispersion_cloud;  // Predicted landing points
+  std::vector<std::vector<BallPosition>> dispersion_contours;  // Closed outlines, inner first
 };
 
 class Renderer {
@@ -33,6 +36,8 @@ public:
   void setViewMode(ViewMode mode);  // Switch between views
   void drawGreen(const GreenData& green);
   void drawTrajectory(const GreenData& green);  // Draw ball flight path
+  void drawDispersion(const GreenData& green);  // Landing cloud and ellipses
+  void drawPredictedArc(const GreenData& green);  // Dashed preview of the shot
   void drawBalls(const std::vector<BallPosition>& positions);
   void drawAimDirection(const BallPosition& tee_pos, float aim_angle_deg, float power);  // Draw aim arrow
   void drawCurrentBall(const GreenData& green);  // Draw in-flight ball
@@ -3,27 +3,95 @@
 #include "application/CoordinateConverter.hpp"
 #include <raylib.h>
 #include <filesystem>
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
 
+namespace {
+
+domain::PhysicsConfig makePhysicsConfig() {
+  domain::PhysicsConfig config;
+  config.gravity = 9.80665;
+  config.drag_coefficient = 0.02;
+  // Steady breeze under the hole's WindField; live shots and the aiming
+  // previews add the field (see App::loadHole)
+  config.wind_velocity = domain::Vec3(1.0, 0.0, 0.0);  // 1 m/s wind
+  config.dt_fixed_sec = 1.0 / 240.0;
+  // Venue air (density and viscosity from altitude, temperature, humidity);
+  // sea-level constants unless the venue is configured
+  if (const char* altitude = std::getenv("VENUE_ALTITUDE_M")) {
+    config.use_atmosphere = true;
+    config.atmosphere.altitude_m = std::atof(altitude);
+  }
+  if (const char* temperature = std::getenv("VENUE_TEMPERATURE_C")) {
+    config.use_atmosphere = true;
+    config.atmosphere.temperature_c = std::atof(temperature);
+  }
+  if (const char* humidity = std::getenv("VENUE_HUMIDITY")) {
+    config.use_atmosphere = true;
+    config.atmosphere.relative_humidity = std::atof(humidity);
+  }
+  // Reynolds/spin-dependent drag and Magnus lift (backspin, slice, hook)
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  // Bounce and roll after touchdown
+  config.ground_phase = true;
+  // Resolve the whole flight at impact; rendering only plays it back
+  config.precompute_flight = true;
+  return config;
+}
+
+constexpr size_t DISPERSION_SAMPLES = 512;
+constexpr uint64_t DISPERSION_SEED = 1;  // Fixed: the cloud must not flicker
+constexpr int CONTOUR_SEGMENTS = 32;
+
+} // namespace
+
 App::App()
-  : physics_(physics_config_)
+  : physics_config_(makePhysicsConfig())
+  , physics_(physics_config_)
   , shot_service_()
-  , sensor_provider_(std::make_unique<infrastructure::MockSensorProvider>(
-      infrastructure::MockSensorProvider::Scenario::Basic, 42))
-  , renderer_(std::make_unique<Renderer>()) {
-  
-  // Configure physics
-  physics_config_.gravity = 9.80665;
-  physics_config_.drag_coefficient = 0.02;
-  physics_config_.wind_velocity = domain::Vec3(1.0, 0.0, 0.0);  // 1 m/s wind
-  physics_config_.dt_fixed_sec = 1.0 / 240.0;
+  , shot_solver_(shot_service_, physics_config_)
+  , arc_preview_(shot_service_, physics_config_)
+  , thread_pool_(std::make_unique<application::ThreadPool>())
+  , renderer_(std::make_unique<Renderer>())
+  , green_(std::make_unique<GreenData>()) {
   
   // Initialize use cases (dependency injection)
   execute_shot_ = std::make_unique<application::ExecuteShotUseCase>(
     state_machine_, physics_, shot_service_);
   update_physics_ = std::make_unique<application::UpdatePhysicsUseCase>(
     state_machine_, physics_);
+  simulation_ = std::make_unique<application::SimulationThread>(
+    state_machine_, physics_, *execute_shot_, *update_physics_);
+  dispersion_ = std::make_unique<application::DispersionService>(
+    shot_service_, physics_config_, *thread_pool_);
+  
+  // Sensor input: a recorded trace (real time, or as fast as polled with
+  // GOLF_SIM_REPLAY_FAST) keeps its own timestamps; the mock is restamped
+  infrastructure::InputThreadConfig input_config;
+  if (const char* trace_path = std::getenv("GOLF_SIM_TRACE")) {
+    auto mode = std::getenv("GOLF_SIM_REPLAY_FAST") ? infrastructure::ReplaySensorProvider::Mode::Fast
+                                                    : infrastructure::ReplaySensorProvider::Mode::Sync;
+    auto replay = std::make_unique<infrastructure::ReplaySensorProvider>(trace_path, mode);
+    if (!replay->isOpen()) {
+      std::cout << "[Info] Trace not readable: " << trace_path << std::endl;
+    }
+    sensor_provider_ = std::move(replay);
+    input_config.restamp_frames = false;
+  } else {
+    auto mock = std::make_unique<infrastructure::MockSensorProvider>(
+      infrastructure::MockSensorProvider::Scenario::Basic, 42);
+    mock_sensor_ = mock.get();
+    sensor_provider_ = std::move(mock);
+  }
+  input_thread_ = std::make_unique<infrastructure::InputThread>(*sensor_provider_, sensor_events_, input_config);
+  if (const char* record_path = std::getenv("GOLF_SIM_RECORD")) {
+    trace_recorder_ = std::make_unique<infrastructure::TraceRecorder>(record_path);
+    if (!trace_recorder_->isOpen()) {
+      std::cout << "[Info] Trace not writable: " << record_path << std::endl;
+    }
+    trace_recorder_->start();
+  }
 
   std::string course_path = "../data/course.csv";
   if (const char* env_path = std::getenv("COURSE_CSV_PATH")) {
@@ -34,10 +102,41 @@ App::App()
   }
   course_repo_ = std::make_unique<infrastructure::FileCourseRepository>(course_path);
   
+  std::string landing_cache_path = "landing_table.cache";
+  if (const char* env_path = std::getenv("LANDING_CACHE_PATH")) {
+    landing_cache_path = env_path;
+  }
+  landing_cache_ = std::make_unique<infrastructure::FileLandingCacheRepository>(landing_cache_path);
+  landing_table_ = std::make_unique<application::LandingTable>(
+    shot_service_, physics_config_, landing_cache_.get());
+  landing_table_->start();  // Maps the cache, or builds on a background thread
+  
   setup();
+  
+  // Optional: physics at a fixed rate on its own thread, decoupled from
+  // vsync and GPU stalls
+  if (std::getenv("GOLF_SIM_THREAD")) {
+    simulation_->start();
+  }
+  
+  // Sensor sampling never waits for a frame
+  input_thread_->start();
 }
 
 App::~App() {
+  input_thread_->stop();
+  infrastructure::InputThreadStats input = input_thread_->stats();
+  std::cout << "[Input] " << input.frames << " frames, " << input.poll_rate_hz << " Hz polling, jitter "
+            << input.mean_jitter_us << " us mean / " << input.max_jitter_us << " us max, "
+            << input.overruns << " overruns, " << sensor_events_.dropped() << " events dropped" << std::endl;
+  if (trace_recorder_) {
+    trace_recorder_->stop();
+    infrastructure::TraceRecorderStats recorded = trace_recorder_->stats();
+    std::cout << "[Record] " << recorded.written << " rows, " << recorded.bytes_written << " bytes, "
+              << recorded.dropped << " dropped in " << recorded.backpressure << " stalls"
+              << (recorded.write_error ? ", write error" : "") << std::endl;
+  }
+  simulation_->stop();
   CloseWindow();
 }
 
@@ -48,9 +147,7 @@ void App::setup() {
   renderer_->init(SCREEN_WIDTH, SCREEN_HEIGHT);
   
   // Load first hole info
-  current_course_ = course_repo_->loadHole(hole_number_);
-  current_par_ = current_course_.par;
-  current_distance_m_ = current_course_.pin_distance_m;
+  loadHole(hole_number_);
 
   // Start in Idle state with Intro screen
   screen_flow_.resetToIntro();
@@ -61,10 +158,38 @@ void App::setup() {
   current_params_.aim_angle_deg = 0.0f;
 }
 
+void App::loadHole(int hole_number) {
+  current_course_ = course_repo_->loadHole(hole_number);
+  current_par_ = current_course_.par;
+  current_distance_m_ = current_course_.pin_distance_m;
+  
+  // Wind for this hole: log profile plus gusts seeded by the hole number
+  domain::WindFieldConfig wind;
+  wind.speed_mps = current_course_.wind_speed_mps;
+  wind.direction_deg = current_course_.wind_direction_deg;
+  wind.max_downrange_m = std::max(wind.max_downrange_m, current_distance_m_ + 60.0);
+  wind.seed = static_cast<uint64_t>(hole_number);
+  wind_field_ = std::make_shared<const domain::WindField>(wind);
+  
+  // Aiming previews fly through the same wind; results for the old hole
+  // (solver warm start, cached arcs, dispersion cloud) no longer apply
+  shot_solver_.setWindField(wind_field_);
+  arc_preview_.setWindField(wind_field_);
+  dispersion_->setWindField(wind_field_);
+  dispersion_valid_ = false;
+  
+  // Ball back on the tee, flying through this hole's wind
+  application::SimulationCommand next_hole;
+  next_hole.type = application::SimulationCommand::Type::NextHole;
+  next_hole.wind_field = wind_field_;
+  simulation_->post(next_hole);
+}
+
 void App::run() {
   while (!WindowShouldClose()) {
     double dt = GetFrameTime();
     
+    pollSensors();
     handleInput();
     update(dt);
     render();
@@ -77,14 +202,16 @@ void App::handleInput() {
     // Intro screen: SPACE/ENTER to start playing
     if (IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_ENTER)) {
       if (screen_flow_.advanceFromIntro()) {
-        state_machine_.transitionToArmed();
+        application::SimulationCommand arm;
+        arm.type = application::SimulationCommand::Type::Arm;
+        simulation_->post(arm);
       }
     }
     return;  // No other input during intro
   }
   
   // Playing state: normal game input
-  domain::GameState state = state_machine_.getCurrentState();
+  domain::GameState state = simulation_->latest().game_state;
   
   // View mode toggles
   if (IsKeyPressed(KEY_V) || IsKeyPressed(KEY_C)) {
@@ -121,20 +248,25 @@ void App::handleInput() {
     // Execute shot
     if (IsKeyPressed(KEY_SPACE)) {
       screen_flow_.onShot();
-      execute_shot_->execute(current_params_);
+      if (mock_sensor_) {
+        current_params_.spin_axis_deg = static_cast<float>(mock_sensor_->getSpinAxisDeg());
+        // The mock sensor reports the swing too (its frame goes through sensor_events_)
+        const application::ClubData& club = shot_service_.getClubData(current_params_.club_index);
+        mock_sensor_->triggerImpact(club.base_speed_mps * current_params_.power, club.base_angle_deg);
+      }
+      application::SimulationCommand shoot;
+      shoot.type = application::SimulationCommand::Type::Shoot;
+      shoot.params = current_params_;
+      shoot.wind_time_offset_sec = GetTime();  // Each shot meets the gusts blowing now
+      simulation_->post(shoot);
     }
   }
   else if (state == domain::GameState::Result) {
     // Next hole
     if (IsKeyPressed(KEY_SPACE)) {
-      physics_.reset();
-      state_machine_.transitionToIdle();
       hole_number_++;
       screen_flow_.onNextHole();
-      current_course_ = course_repo_->loadHole(hole_number_);
-      current_par_ = current_course_.par;
-      current_distance_m_ = current_course_.pin_distance_m;
-    screen_flow_.onNextHole();
+      loadHole(hole_number_);
       
       // Reset parameters
       current_params_.power = 0.7f;
@@ -143,9 +275,60 @@ void App::handleInput() {
   }
 }
 
+void App::pollSensors() {
+  if (!input_thread_->isRunning()) {
+    input_thread_->pollOnce();
+  }
+  
+  infrastructure::Event event;
+  while (sensor_events_.pop(event)) {
+    ++sensor_events_handled_;
+    if (trace_recorder_) {
+      trace_recorder_->record(event);
+    }
+    
+    application::Impact impact;
+    if (event.type != infrastructure::Event::Type::Pose ||
+        !impact_detector_.update(event.t_sec, event.frame.az, impact) || mock_sensor_) {
+      continue;
+    }
+    // Club and aim from the UI, power from the swing
+    if (simulation_->latest().game_state == domain::GameState::Armed) {
+      screen_flow_.onShot();
+      simulation_->post(application::ImpactDetector::shotCommand(impact, current_params_, GetTime()));
+    }
+  }
+}
+
 void App::update(double dt) {
-  // Update physics if in flight
-  update_physics_->update(dt);
+  // Single-threaded: one simulation tick per frame
+  if (!simulation_->isRunning()) {
+    simulation_->advance(dt);
+  }
+  
+  if (simulation_->latest().game_state == domain::GameState::Armed) {
+    updateDispersion();
+    // Bounded work per frame; keeps showing the last arc until the new one lands
+    arc_preview_.update(current_params_);
+    // Warm-started from last frame: usually a single headless flight
+    caddie_advice_ = shot_solver_.solve(current_params_.club_index, {current_distance_m_, 0.0},
+                                         current_params_.spin_axis_deg);
+  }
+}
+
+void App::updateDispersion() {
+  // Runs in the background; the last finished cloud is drawn meanwhile
+  dispersion_->poll(dispersion_result_);
+  bool changed = !dispersion_valid_
+    || dispersion_params_.club_index != current_params_.club_index
+    || dispersion_params_.power != current_params_.power
+    || dispersion_params_.aim_angle_deg != current_params_.aim_angle_deg;
+  if (!changed) {
+    return;
+  }
+  dispersion_->request(current_params_, DISPERSION_SAMPLES, DISPERSION_SEED);
+  dispersion_params_ = current_params_;
+  dispersion_valid_ = true;
 }
 
 void App::render() {
@@ -158,7 +341,9 @@ void App::render() {
   
   BeginDrawing();
  
-  domain::GameState state = state_machine_.getCurrentState();
+  // Newest simulation snapshot; stable for the whole frame
+  const application::SimulationSnapshot& sim = simulation_->latest();
+  domain::GameState state = sim.game_state;
 
   // Handle state transitions to stabilize view switching
   screen_flow_.onGameStateChange(state);
@@ -169,10 +354,11 @@ void App::render() {
   
   renderer_->setViewMode(desired_view);
   
-  // Prepare green data for rendering
-  GreenData green;
+  // Prepare green data for rendering (storage reused across frames)
+  GreenData& green = *green_;
   green.width = 20.0f;
   green.length = 35.0f;
+  green.trajectory.clear();
   
   if (state == domain::GameState::Armed) {
     // Setup screen
@@ -186,6 +372,40 @@ void App::render() {
       renderer_->drawIntroSceneLayer(hole_number_, 4, 350.0f, false);
     } else {
       renderer_->drawGreen(green);
+      
+      // Predicted landing cloud and 50%/90% dispersion ellipses
+      green.dispersion_cloud.clear();
+      green.dispersion_contours.resize(dispersion_result_.contours.size());
+      for (const domain::Vec3& landing : dispersion_result_.landings) {
+        auto p = application::CoordinateConverter::toRenderCoordinates(landing);
+        green.dispersion_cloud.push_back({p.x, p.y});
+      }
+      for (size_t c = 0; c < dispersion_result_.contours.size(); ++c) {
+        const application::DispersionContour& contour = dispersion_result_.contours[c];
+        std::vector<BallPosition>& outline = green.dispersion_contours[c];
+        outline.clear();
+        double ca = std::cos(contour.angle_rad);
+        double sa = std::sin(contour.angle_rad);
+        for (int i = 0; i <= CONTOUR_SEGMENTS; ++i) {
+          double phi = 2.0 * M_PI * i / CONTOUR_SEGMENTS;
+          double u = contour.semi_major_m * std::cos(phi);
+          double v = contour.semi_minor_m * std::sin(phi);
+          domain::Vec3 point(dispersion_result_.mean.x + u * ca - v * sa,
+                             dispersion_result_.mean.y + u * sa + v * ca, 0.0);
+          auto p = application::CoordinateConverter::toRenderCoordinates(point);
+          outline.push_back({p.x, p.y});
+        }
+      }
+      renderer_->drawDispersion(green);
+      
+      green.predicted_arc.clear();
+      for (const auto& point : arc_preview_.getArc()) {
+        auto p = application::CoordinateConverter::toRenderCoordinates(
+          domain::Vec3(point.x, point.y, point.z));
+        green.predicted_arc.push_back({p.x, p.y, p.height});
+      }
+      renderer_->drawPredictedArc(green);
+      
       renderer_->drawBalls(green.ball_positions);
       // Draw aim direction arrow
       BallPosition tee = {0.0f, application::CoordinateConverter::TEE_RENDER_OFFSET_Y};
@@ -199,22 +419,66 @@ void App::render() {
     DrawText(TextFormat("Club: %s", club.name), 20, 110, 20, WHITE);
     DrawText(TextFormat("Power: %.0f%%", current_params_.power * 100), 20, 140, 20, WHITE);
     DrawText(TextFormat("Aim: %.1f deg", current_params_.aim_angle_deg), 20, 170, 20, WHITE);
+    switch (caddie_advice_.status) {
+      case application::ShotSolution::Status::Solved:
+        DrawText(TextFormat("Caddie: %.0f%% power, aim %.1f deg",
+                            caddie_advice_.power * 100, caddie_advice_.aim_angle_deg),
+                 20, 200, 20, {180, 255, 180, 255});
+        break;
+      case application::ShotSolution::Status::TooLong:
+        DrawText("Caddie: out of range, take more club", 20, 200, 20, {255, 200, 150, 255});
+        break;
+      case application::ShotSolution::Status::TooShort:
+        DrawText("Caddie: too close, take less club", 20, 200, 20, {255, 200, 150, 255});
+        break;
+      case application::ShotSolution::Status::NotConverged:
+        DrawText(TextFormat("Caddie: no exact line, about %.0f%% power, aim %.1f deg",
+                            caddie_advice_.power * 100, caddie_advice_.aim_angle_deg),
+                 20, 200, 20, {255, 200, 150, 255});
+        break;
+    }
+    // Steady breeze plus the hole's gust-free wind at anemometer height
+    const domain::Vec3 wind = physics_config_.wind_velocity + wind_field_->meanWind(10.0);
+    application::LandingEstimate estimate;
+    if (landing_table_->lookup(current_params_.club_index, current_params_.power,
+                               current_params_.aim_angle_deg, wind, estimate)) {
+      DrawText(TextFormat("Est. landing: %.0f m, %.1f m %s", estimate.y, std::abs(estimate.x),
+                          estimate.x >= 0.0 ? "right" : "left"),
+               20, 230, 20, LIGHTGRAY);
+    } else {
+      DrawText("Est. landing: building table...", 20, 230, 20, LIGHTGRAY);
+    }
+    DrawText(TextFormat("Wind: %.1f m/s, %.0f deg (gusting)", wind.length(),
+                        std::atan2(wind.y, wind.x) * 180.0 / M_PI),
+             20, 260, 20, {150, 190, 255, 255});
+    infrastructure::InputThreadStats input = input_thread_->stats();
+    DrawText(TextFormat("Sensor: %.0f Hz poll, jitter %.0f/%.0f us, %llu overruns | events %llu handled, %zu dropped (peak %zu)",
+                        input.poll_rate_hz, input.mean_jitter_us, input.max_jitter_us,
+                        static_cast<unsigned long long>(input.overruns),
+                        static_cast<unsigned long long>(sensor_events_handled_),
+                        sensor_events_.dropped(), sensor_events_.highWaterMark()),
+             20, 290, 16, LIGHTGRAY);
     DrawText("SPACE to shoot | Arrows: club/power | A/D: aim", 20, SCREEN_HEIGHT - 40, 16, LIGHTGRAY);
   }
   else if (state == domain::GameState::InFlight || state == domain::GameState::Result) {
     // Flight or result screen (overhead view)
-    const domain::Trajectory& traj = physics_.getTrajectory();
+    // Ball blended between the last two physics steps, so motion stays
+    // smooth when the physics rate is below the frame rate
+    const domain::BallState& ball = sim.ball;
     
-    // Convert trajectory from domain (physics) coordinates to render coordinates
-    auto render_points = application::CoordinateConverter::toRenderTrajectory(traj);
-    green.trajectory.clear();
-    for (const auto& point : render_points) {
+    // Trail already in render coordinates, up to the ball's time (the
+    // flight may be precomputed)
+    for (const auto& point : sim.trail) {
       green.trajectory.push_back({point.x, point.y, point.height});
     }
+    if (state == domain::GameState::InFlight && !sim.trail.empty()) {
+      // Trail ends at the ball, not at the last recorded sample
+      auto tip = application::CoordinateConverter::toRenderCoordinates(ball.pos);
+      green.trajectory.push_back({tip.x, tip.y, tip.height});
+    }
     
-    if (!traj.empty()) {
-      const domain::BallState& last = traj.getLastPoint();
-      auto render_pos = application::CoordinateConverter::toRenderCoordinates(last.pos);
+    if (!sim.trail.empty()) {
+      auto render_pos = application::CoordinateConverter::toRenderCoordinates(ball.pos);
       green.current_ball_pos.x = render_pos.x;
       green.current_ball_pos.y = render_pos.y;
     }
@@ -230,16 +494,20 @@ void App::render() {
       DrawRectangle(10, SCREEN_HEIGHT - 50, SCREEN_WIDTH - 20, 40, {0, 0, 0, 140});
       DrawRectangleLines(10, SCREEN_HEIGHT - 50, SCREEN_WIDTH - 20, 40, {255, 255, 255, 60});
       DrawText("In-flight | C/V: toggle silhouette", 20, SCREEN_HEIGHT - 40, 16, {255, 220, 200, 255});
+      if (sim.result_available) {
+        // Landing is known at impact when the flight is precomputed
+        DrawText(TextFormat("Carry: %.1f m", sim.result.carry_m), 20, 20, 20, WHITE);
+      }
     }
     
     if (state == domain::GameState::Result) {
-      domain::ShotResult result = physics_.calculateResult();
+      const domain::ShotResult& result = sim.result;
       
       DrawRectangle(SCREEN_WIDTH / 2 - 200, SCREEN_HEIGHT / 2 - 100, 400, 200, {0, 0, 0, 180});
       DrawRectangleLines(SCREEN_WIDTH / 2 - 200, SCREEN_HEIGHT / 2 - 100, 400, 200, {255, 200, 100, 255});
       DrawText("SHOT COMPLETE!", SCREEN_WIDTH / 2 - 140, SCREEN_HEIGHT / 2 - 80, 20, {255, 200, 100, 255});
       DrawText(TextFormat("Carry: %.1f m", result.carry_m), SCREEN_WIDTH / 2 - 100, SCREEN_HEIGHT / 2 - 40, 18, WHITE);
-      DrawText(TextFormat("Total: %.1f m", result.total_m), SCREEN_WIDTH / 2 - 100, SCREEN_HEIGHT / 2 - 10, 18, WHITE);
+      DrawText(TextFormat("Total: %.1f m (roll %.1f m)", result.total_m, result.roll_m), SCREEN_WIDTH / 2 - 100, SCREEN_HEIGHT / 2 - 10, 18, WHITE);
       DrawText(TextFormat("Lateral: %.1f m", result.lateral_m), SCREEN_WIDTH / 2 - 100, SCREEN_HEIGHT / 2 + 20, 18, WHITE);
       DrawText(TextFormat("Time: %.2f s", result.flight_time_s), SCREEN_WIDTH / 2 - 100, SCREEN_HEIGHT / 2 + 50, 18, WHITE);
       DrawText("SPACE: next hole | C/V: toggle silhouette", SCREEN_WIDTH / 2 - 160, SCREEN_HEIGHT / 2 + 80, 14, {255, 220, 200, 255});
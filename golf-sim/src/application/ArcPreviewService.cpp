@@ -0,0 +1,153 @@
+#include "application/ArcPreviewService.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace application {
+
+namespace {
+
+domain::PhysicsConfig previewConfig(domain::PhysicsConfig physics, const ArcPreviewConfig& preview) {
+  // Carry arc only, stepped a bounded amount per frame
+  physics.integrator = domain::PhysicsConfig::Integrator::RK4;
+  physics.dt_fixed_sec = preview.step_sec;
+  physics.precompute_flight = false;
+  physics.ground_phase = false;
+  physics.max_trajectory_points = preview.max_points;
+  return physics;
+}
+
+} // namespace
+
+ArcPreviewService::ArcPreviewService(const ShotParameterService& shot_service,
+                                     const domain::PhysicsConfig& physics_config,
+                                     const ArcPreviewConfig& config)
+  : shot_service_(shot_service)
+  , physics_config_(previewConfig(physics_config, config))
+  , config_(config)
+  , engine_(physics_config_)
+  , cache_(std::max<size_t>(config.cache_entries, 1)) {
+  for (Entry& entry : cache_) {
+    entry.points.reserve(config_.max_points);
+  }
+  shown_.reserve(config_.max_points);
+}
+
+const std::vector<ArcPreviewService::ArcPoint>& ArcPreviewService::update(const ShotParameters& params) {
+  request_key_ = quantize(params);
+  has_request_ = true;
+  
+  if (!has_shown_ || request_key_ != shown_key_) {
+    if (Entry* hit = find(request_key_)) {
+      ++cache_hits_;
+      show(*hit);
+    } else if (!pending_) {
+      start(request_key_);
+    }
+  }
+  
+  if (pending_) {
+    advance();
+  }
+  return shown_;
+}
+
+void ArcPreviewService::setWindField(std::shared_ptr<const domain::WindField> field) {
+  wind_field_ = std::move(field);
+  engine_.setWindField(wind_field_.get());
+  for (Entry& entry : cache_) {
+    entry.valid = false;
+  }
+  // Keep shown_ on screen, but recompute it on the next update()
+  has_shown_ = false;
+  pending_ = false;
+}
+
+ArcPreviewService::Key ArcPreviewService::quantize(const ShotParameters& params) const {
+  Key key;
+  key.club = params.club_index;
+  key.power = static_cast<int32_t>(std::lround(params.power / config_.power_quantum));
+  key.aim = static_cast<int32_t>(std::lround(params.aim_angle_deg / config_.aim_quantum_deg));
+  key.spin_axis = static_cast<int32_t>(std::lround(params.spin_axis_deg / config_.aim_quantum_deg));
+  return key;
+}
+
+ShotParameters ArcPreviewService::dequantize(const Key& key) const {
+  // Arcs are computed at the quantized parameters so a cached arc does not
+  // depend on which request first produced it
+  ShotParameters params;
+  params.club_index = key.club;
+  params.power = key.power * config_.power_quantum;
+  params.aim_angle_deg = key.aim * config_.aim_quantum_deg;
+  params.spin_axis_deg = key.spin_axis * config_.aim_quantum_deg;
+  return params;
+}
+
+ArcPreviewService::Entry* ArcPreviewService::find(const Key& key) {
+  for (Entry& entry : cache_) {
+    if (entry.valid && entry.key == key) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+void ArcPreviewService::show(Entry& entry) {
+  entry.last_used = ++clock_;
+  shown_.assign(entry.points.begin(), entry.points.end());
+  shown_key_ = entry.key;
+  has_shown_ = true;
+}
+
+void ArcPreviewService::start(const Key& key) {
+  engine_.startShot(shot_service_.createLaunchCondition(dequantize(key)));
+  pending_key_ = key;
+  pending_ = true;
+}
+
+void ArcPreviewService::advance() {
+  // Bounded work per frame: at most max_steps_per_frame integration steps
+  engine_.step(config_.max_steps_per_frame * config_.step_sec);
+  
+  if (engine_.hasLanded() || engine_.getCurrentState().t_sec >= physics_config_.max_flight_time_sec) {
+    finish();
+  }
+}
+
+void ArcPreviewService::finish() {
+  pending_ = false;
+  ++computed_;
+  
+  // Evict the least recently used entry
+  Entry* slot = &cache_[0];
+  for (Entry& entry : cache_) {
+    if (!entry.valid) {
+      slot = &entry;
+      break;
+    }
+    if (entry.last_used < slot->last_used) {
+      slot = &entry;
+    }
+  }
+  
+  const domain::Trajectory& trajectory = engine_.getTrajectory();
+  slot->key = pending_key_;
+  slot->valid = true;
+  slot->points.clear();
+  for (size_t i = 0; i < trajectory.size(); ++i) {
+    slot->points.push_back({trajectory.xs()[i], trajectory.ys()[i], trajectory.zs()[i]});
+  }
+  show(*slot);
+  
+  // Input moved on while this arc was computed: start the newest request
+  if (has_request_ && request_key_ != shown_key_) {
+    if (Entry* hit = find(request_key_)) {
+      ++cache_hits_;
+      show(*hit);
+    } else {
+      start(request_key_);
+    }
+  }
+}
+
+} // namespace application
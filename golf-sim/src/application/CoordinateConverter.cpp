@@ -1,4 +1,7 @@
 #include "application/CoordinateConverter.hpp"
+#include "domain/SimdMath.hpp"
+#include <algorithm>
+#include <limits>
 
 namespace application {
 
@@ -13,13 +16,34 @@ CoordinateConverter::RenderPoint CoordinateConverter::toRenderCoordinates(const
 std::vector<CoordinateConverter::RenderPoint> CoordinateConverter::toRenderTrajectory(
     const domain::Trajectory& trajectory) {
   std::vector<RenderPoint> render_points;
-  render_points.reserve(trajectory.size());
+  toRenderTrajectory(trajectory, std::numeric_limits<double>::infinity(), render_points);
+  return render_points;
+}
+
+std::vector<CoordinateConverter::RenderPoint> CoordinateConverter::toRenderTrajectory(
+    const domain::Trajectory& trajectory, double until_t_sec) {
+  std::vector<RenderPoint> render_points;
+  toRenderTrajectory(trajectory, until_t_sec, render_points);
+  return render_points;
+}
+
+void CoordinateConverter::toRenderTrajectory(const domain::Trajectory& trajectory,
+                                             double until_t_sec,
+                                             std::vector<RenderPoint>& out) {
+  out.clear();
+  out.reserve(trajectory.capacity());
   
-  for (const auto& point : trajectory.getPoints()) {
-    render_points.push_back(toRenderCoordinates(point.pos));
-  }
+  // Sample times are increasing: everything up to the first later sample
+  const float* t = trajectory.times();
+  size_t count = static_cast<size_t>(
+    std::upper_bound(t, t + trajectory.size(), until_t_sec,
+                     [](double limit, float sample) { return limit < sample; }) - t);
   
-  return render_points;
+  // Read the float columns directly and interleave them 4 points at a time
+  out.resize(count);
+  domain::simd::interleaveTranslated(trajectory.xs(), trajectory.ys(), trajectory.zs(),
+                                     0.0f, TEE_RENDER_OFFSET_Y, 0.0f,
+                                     reinterpret_cast<float*>(out.data()), count);
 }
 
 } // namespace application
@@ -0,0 +1,238 @@
+#include "application/DispersionService.hpp"
+#include "domain/PhysicsEngine.hpp"
+#include "domain/SplitMix64.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace application {
+
+namespace {
+
+// SplitMix64 (the wind field's generator), trivially seeded per chunk
+class RandomStream {
+public:
+  RandomStream(uint64_t seed, uint64_t stream)
+    : state_(seed ^ (stream * 0x9E3779B97F4A7C15ull)) {
+    next();
+  }
+  
+  uint64_t next() { return domain::splitMix64(state_); }
+  
+  // Uniform in (0, 1)
+  double uniform() {
+    return (static_cast<double>(next() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+  }
+  
+  // Standard normal (Box-Muller, both values used)
+  double normal() {
+    if (has_spare_) {
+      has_spare_ = false;
+      return spare_;
+    }
+    double r = std::sqrt(-2.0 * std::log(uniform()));
+    double theta = 2.0 * M_PI * uniform();
+    spare_ = r * std::sin(theta);
+    has_spare_ = true;
+    return r * std::cos(theta);
+  }
+  
+private:
+  uint64_t state_;
+  double spare_ = 0.0;
+  bool has_spare_ = false;
+};
+
+// Rotate about +z by `angle` toward +x (same sense as the aim angle)
+domain::Vec3 yaw(const domain::Vec3& v, double angle) {
+  double c = std::cos(angle);
+  double s = std::sin(angle);
+  return domain::Vec3(v.x * c + v.y * s, -v.x * s + v.y * c, v.z);
+}
+
+} // namespace
+
+DispersionService::DispersionService(const ShotParameterService& shot_service,
+                                     const domain::PhysicsConfig& physics_config,
+                                     ThreadPool& pool,
+                                     const DispersionSpread& spread)
+  : shot_service_(shot_service)
+  , physics_config_(domain::headlessLandingConfig(physics_config))
+  , pool_(pool)
+  , spread_(spread) {
+}
+
+DispersionService::~DispersionService() {
+  wait();
+}
+
+void DispersionService::setWindField(std::shared_ptr<const domain::WindField> field) {
+  // The running request reads the field and its result is for the old wind
+  cancel();
+  wind_field_ = std::move(field);
+}
+
+void DispersionService::request(const ShotParameters& params, size_t samples, uint64_t seed) {
+  Job job;
+  job.params = params;
+  job.samples = samples;
+  job.seed = seed;
+  if (worker_.joinable() || job_done_.load(std::memory_order_relaxed)) {
+    next_job_ = job;  // Replaces an older queued request
+    has_next_job_ = true;
+    return;
+  }
+  launch(job);
+}
+
+bool DispersionService::poll(DispersionResult& out) {
+  if (!job_done_.load(std::memory_order_acquire)) {
+    return false;
+  }
+  wait();
+  job_done_.store(false, std::memory_order_relaxed);
+  std::swap(out, job_result_);  // Both keep their storage for the next one
+  if (has_next_job_) {
+    has_next_job_ = false;
+    launch(next_job_);
+  }
+  return true;
+}
+
+void DispersionService::wait() {
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+void DispersionService::launch(const Job& job) {
+  job_done_.store(false, std::memory_order_relaxed);
+  worker_ = std::thread([this, job] {
+    analyze(job.params, job.samples, job.seed, job_result_);
+    job_done_.store(true, std::memory_order_release);
+  });
+}
+
+void DispersionService::cancel() {
+  // The worker stops at its next chunk instead of finishing the cloud
+  cancel_.store(true, std::memory_order_relaxed);
+  wait();
+  cancel_.store(false, std::memory_order_relaxed);
+  job_done_.store(false, std::memory_order_relaxed);
+  has_next_job_ = false;
+}
+
+void DispersionService::analyze(const ShotParameters& params, size_t samples, uint64_t seed,
+                                DispersionResult& out) const {
+  const domain::LaunchCondition nominal = shot_service_.createLaunchCondition(params);
+  const domain::Vec3 v0 = domain::PhysicsEngine::launchVelocity(nominal);
+  const double speed = v0.length();
+  const double elevation = speed > 0.0 ? std::asin(v0.z / speed) : 0.0;
+  const double heading = std::atan2(v0.x, v0.y);
+  const double deg = M_PI / 180.0;
+  
+  out.landings.resize(samples);
+  size_t chunks = (samples + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  
+  pool_.parallelFor(chunks, [&](size_t chunk) {
+    if (cancel_.load(std::memory_order_relaxed)) {
+      return;
+    }
+    RandomStream rng(seed, chunk);
+    domain::PhysicsEngine engine(physics_config_);
+    engine.setWindField(wind_field_.get());
+    size_t end = std::min(samples, (chunk + 1) * CHUNK_SIZE);
+    
+    for (size_t i = chunk * CHUNK_SIZE; i < end; ++i) {
+      double s = speed * (1.0 + 0.01 * spread_.speed_pct * rng.normal());
+      double el = elevation + spread_.launch_angle_deg * deg * rng.normal();
+      double d_aim = spread_.aim_deg * deg * rng.normal();
+      double spin_scale = 1.0 + 0.01 * spread_.spin_pct * rng.normal();
+      domain::Vec3 gust(spread_.gust_mps * rng.normal(), spread_.gust_mps * rng.normal(), 0.0);
+      
+      domain::LaunchCondition launch = nominal;
+      launch.launch_speed_mps = s;
+      launch.launch_angle_deg = el / deg;
+      launch.initial_velocity = domain::Vec3(s * std::cos(el) * std::sin(heading + d_aim),
+                                             s * std::cos(el) * std::cos(heading + d_aim),
+                                             s * std::sin(el));
+      launch.initial_spin = yaw(nominal.initial_spin, d_aim) * spin_scale;
+      
+      engine.setWindVelocity(physics_config_.wind_velocity + gust);
+      engine.startShot(launch);
+      engine.step(physics_config_.max_flight_time_sec);
+      out.landings[i] = engine.calculateResult().landing_position;
+    }
+  });
+  
+  if (cancel_.load(std::memory_order_relaxed)) {
+    return;  // Partial cloud; cancel() drops it
+  }
+  computeStatistics(out);
+}
+
+void DispersionService::computeStatistics(DispersionResult& out) const {
+  out.mean = domain::Vec3();
+  out.cov_xx = out.cov_xy = out.cov_yy = 0.0;
+  out.contours.clear();
+  const size_t n = out.landings.size();
+  if (n == 0) {
+    return;
+  }
+  
+  // Sequential in sample order: bit-identical for any thread count
+  double sx = 0.0, sy = 0.0;
+  for (const domain::Vec3& p : out.landings) {
+    sx += p.x;
+    sy += p.y;
+  }
+  out.mean = domain::Vec3(sx / n, sy / n, 0.0);
+  
+  for (const domain::Vec3& p : out.landings) {
+    double dx = p.x - out.mean.x;
+    double dy = p.y - out.mean.y;
+    out.cov_xx += dx * dx;
+    out.cov_xy += dx * dy;
+    out.cov_yy += dy * dy;
+  }
+  double norm = n > 1 ? 1.0 / (n - 1) : 0.0;
+  out.cov_xx *= norm;
+  out.cov_xy *= norm;
+  out.cov_yy *= norm;
+  
+  // Principal axes of the covariance
+  double half_trace = 0.5 * (out.cov_xx + out.cov_yy);
+  double half_diff = 0.5 * (out.cov_xx - out.cov_yy);
+  double root = std::sqrt(half_diff * half_diff + out.cov_xy * out.cov_xy);
+  double lambda_major = half_trace + root;
+  double lambda_minor = std::max(0.0, half_trace - root);
+  double angle = 0.5 * std::atan2(2.0 * out.cov_xy, out.cov_xx - out.cov_yy);
+  double det = out.cov_xx * out.cov_yy - out.cov_xy * out.cov_xy;
+  
+  // Percentile contours: quantiles of the Mahalanobis distance scale the
+  // covariance ellipse (empirical, so skewed clouds are still covered)
+  distances_.resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    double dx = out.landings[i].x - out.mean.x;
+    double dy = out.landings[i].y - out.mean.y;
+    distances_[i] = det > 1e-12
+      ? (out.cov_yy * dx * dx - 2.0 * out.cov_xy * dx * dy + out.cov_xx * dy * dy) / det
+      : 0.0;
+  }
+  std::sort(distances_.begin(), distances_.end());
+  
+  for (double percentile : CONTOUR_PERCENTILES) {
+    size_t k = static_cast<size_t>(std::ceil(percentile * n));
+    k = k > 0 ? k - 1 : 0;
+    double scale = std::sqrt(distances_[std::min(k, n - 1)]);
+    
+    DispersionContour contour;
+    contour.percentile = percentile;
+    contour.semi_major_m = scale * std::sqrt(lambda_major);
+    contour.semi_minor_m = scale * std::sqrt(lambda_minor);
+    contour.angle_rad = angle;
+    out.contours.push_back(contour);
+  }
+}
+
+} // namespace application
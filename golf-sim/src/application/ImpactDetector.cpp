@@ -0,0 +1,53 @@
+#include "application/ImpactDetector.hpp"
+#include <algorithm>
+
+namespace application {
+
+ImpactDetector::ImpactDetector(const ImpactDetectorConfig& config)
+  : config_(config) {
+}
+
+bool ImpactDetector::update(double t_sec, float az, Impact& out) {
+  if (t_sec < quiet_until_sec_) {
+    return false;
+  }
+  
+  if (az >= config_.threshold_mps2) {
+    if (!in_impact_ || az > peak_.peak_mps2) {
+      peak_.t_sec = t_sec;
+      peak_.peak_mps2 = az;
+    }
+    in_impact_ = true;
+    return false;
+  }
+  if (!in_impact_) {
+    return false;
+  }
+  
+  // The run ended on this sample: report its peak
+  in_impact_ = false;
+  float range = std::max(1e-3f, config_.full_power_mps2 - config_.threshold_mps2);
+  float fraction = (peak_.peak_mps2 - config_.threshold_mps2) / range;
+  peak_.power = std::min(MAX_POWER, MIN_POWER + (MAX_POWER - MIN_POWER) * fraction);
+  quiet_until_sec_ = peak_.t_sec + config_.refractory_sec;
+  ++impacts_;
+  out = peak_;
+  return true;
+}
+
+void ImpactDetector::reset() {
+  in_impact_ = false;
+  quiet_until_sec_ = -std::numeric_limits<double>::infinity();
+}
+
+SimulationCommand ImpactDetector::shotCommand(const Impact& impact, const ShotParameters& params,
+                                              double wind_time_offset_sec) {
+  SimulationCommand shoot;
+  shoot.type = SimulationCommand::Type::Shoot;
+  shoot.params = params;
+  shoot.params.power = impact.power;
+  shoot.wind_time_offset_sec = wind_time_offset_sec;
+  return shoot;
+}
+
+} // namespace application
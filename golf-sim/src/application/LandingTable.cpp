@@ -0,0 +1,267 @@
+#include "application/LandingTable.hpp"
+#include "domain/Fnv1a.hpp"
+#include "domain/PhysicsEngine.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace application {
+
+namespace {
+
+constexpr uint64_t TABLE_FORMAT_VERSION = 1;  // Bump when the stored values change meaning
+
+// Grid coordinate of value on [lo, hi] with `points` samples: cell + fraction
+void locate(double value, double lo, double hi, int points, int& cell, double& frac) {
+  if (points < 2 || hi <= lo) {
+    cell = 0;
+    frac = 0.0;
+    return;
+  }
+  double u = (value - lo) / (hi - lo) * (points - 1);
+  u = std::max(0.0, std::min(static_cast<double>(points - 1), u));
+  cell = std::min(static_cast<int>(u), points - 2);
+  frac = u - cell;
+}
+
+// Landing relative to the aim line (+y along the aim). Aim mostly rotates
+// the landing point, which linear interpolation across aim would cut short;
+// in this frame what is left varies smoothly with aim.
+domain::Vec3 toAimFrame(const LandingEstimate& landing, double aim_deg) {
+  double aim_rad = aim_deg * M_PI / 180.0;
+  double c = std::cos(aim_rad);
+  double s = std::sin(aim_rad);
+  return domain::Vec3(landing.x * c - landing.y * s, landing.x * s + landing.y * c, 0.0);
+}
+
+double gridValue(int i, double lo, double hi, int points) {
+  return points < 2 ? lo : lo + (hi - lo) * i / (points - 1);
+}
+
+} // namespace
+
+LandingTable::LandingTable(const ShotParameterService& shot_service,
+                           const domain::PhysicsConfig& physics_config,
+                           LandingCacheRepository* cache,
+                           const LandingTableLayout& layout)
+  : shot_service_(shot_service)
+  , physics_config_(domain::headlessLandingConfig(physics_config))
+  , cache_(cache)
+  , layout_(layout) {
+  key_ = computeKey();
+}
+
+LandingTable::~LandingTable() {
+  cancel_.store(true, std::memory_order_relaxed);
+  if (builder_.joinable()) {
+    builder_.join();
+  }
+}
+
+void LandingTable::start() {
+  if (isReady() || builder_.joinable()) {
+    return;
+  }
+  
+  if (cache_) {
+    mapped_ = cache_->load(key_);
+    if (mapped_ && mapped_->size() == tableSize()) {
+      values_ = mapped_->data();
+      from_cache_ = true;
+      ready_.store(true, std::memory_order_release);
+      return;
+    }
+    mapped_.reset();
+  }
+  builder_ = std::thread(&LandingTable::build, this);
+}
+
+void LandingTable::wait() {
+  if (builder_.joinable()) {
+    builder_.join();
+  }
+}
+
+void LandingTable::build() {
+  std::vector<float> table(tableSize());
+  const double max_wind = layout_.max_wind_mps;
+  
+  for (int club = 0; club < ShotParameterService::NUM_CLUBS; ++club) {
+    for (int ip = 0; ip < layout_.power_points; ++ip) {
+      double power = gridValue(ip, layout_.min_power, layout_.max_power, layout_.power_points);
+      for (int ia = 0; ia < layout_.aim_points; ++ia) {
+        double aim = gridValue(ia, -layout_.max_aim_deg, layout_.max_aim_deg, layout_.aim_points);
+        for (int iwx = 0; iwx < layout_.wind_points; ++iwx) {
+          for (int iwy = 0; iwy < layout_.wind_points; ++iwy) {
+            if (cancel_.load(std::memory_order_relaxed)) {
+              return;
+            }
+            domain::Vec3 wind(gridValue(iwx, -max_wind, max_wind, layout_.wind_points),
+                              gridValue(iwy, -max_wind, max_wind, layout_.wind_points), 0.0);
+            LandingEstimate landing = simulate(club, power, aim, wind);
+            domain::Vec3 local = toAimFrame(landing, aim);
+            float* cell = &table[index(club, ip, ia, iwx, iwy)];
+            cell[0] = static_cast<float>(local.x);
+            cell[1] = static_cast<float>(local.y);
+            cell[2] = static_cast<float>(landing.flight_time_s);
+          }
+        }
+      }
+    }
+  }
+  
+  built_ = std::move(table);
+  values_ = built_.data();
+  if (cache_) {
+    cache_->save(key_, built_.data(), built_.size());
+  }
+  ready_.store(true, std::memory_order_release);
+}
+
+LandingEstimate LandingTable::simulate(int club_index, double power, double aim_deg,
+                                       const domain::Vec3& wind) const {
+  ShotParameters params;
+  params.club_index = club_index;
+  params.power = static_cast<float>(power);
+  params.aim_angle_deg = static_cast<float>(aim_deg);
+  
+  domain::PhysicsConfig config = physics_config_;
+  config.wind_velocity = wind;
+  domain::PhysicsEngine engine(config);
+  engine.startShot(shot_service_.createLaunchCondition(params));
+  engine.step(config.max_flight_time_sec);
+  
+  domain::ShotResult result = engine.calculateResult();
+  LandingEstimate out;
+  out.x = result.landing_position.x;
+  out.y = result.landing_position.y;
+  out.flight_time_s = result.flight_time_s;
+  return out;
+}
+
+bool LandingTable::lookup(int club_index, double power, double aim_deg,
+                          const domain::Vec3& wind, LandingEstimate& out) const {
+  if (!isReady() || club_index < 0 || club_index >= ShotParameterService::NUM_CLUBS) {
+    return false;
+  }
+  
+  const double max_wind = layout_.max_wind_mps;
+  int cp, ca, cwx, cwy;
+  double fp, fa, fwx, fwy;
+  locate(power, layout_.min_power, layout_.max_power, layout_.power_points, cp, fp);
+  locate(aim_deg, -layout_.max_aim_deg, layout_.max_aim_deg, layout_.aim_points, ca, fa);
+  locate(wind.x, -max_wind, max_wind, layout_.wind_points, cwx, fwx);
+  locate(wind.y, -max_wind, max_wind, layout_.wind_points, cwy, fwy);
+  
+  // Weighted sum over the 16 corners of the 4D cell
+  double sum[VALUES] = {0.0, 0.0, 0.0};
+  for (int corner = 0; corner < 16; ++corner) {
+    int dp = corner & 1, da = (corner >> 1) & 1, dwx = (corner >> 2) & 1, dwy = (corner >> 3) & 1;
+    double w = (dp ? fp : 1.0 - fp) * (da ? fa : 1.0 - fa)
+             * (dwx ? fwx : 1.0 - fwx) * (dwy ? fwy : 1.0 - fwy);
+    if (w == 0.0) {
+      continue;
+    }
+    const float* cell = &values_[index(club_index, cp + dp, ca + da, cwx + dwx, cwy + dwy)];
+    for (int v = 0; v < VALUES; ++v) {
+      sum[v] += w * cell[v];
+    }
+  }
+  
+  // Back from the aim frame at the queried aim
+  double aim_rad = aim_deg * M_PI / 180.0;
+  double c = std::cos(aim_rad);
+  double s = std::sin(aim_rad);
+  out.x = sum[0] * c + sum[1] * s;
+  out.y = -sum[0] * s + sum[1] * c;
+  out.flight_time_s = sum[2];
+  return true;
+}
+
+LandingTableValidation LandingTable::validate(size_t samples) const {
+  LandingTableValidation report;
+  if (!isReady()) {
+    return report;
+  }
+  
+  // Low-discrepancy off-grid points (additive recurrence, deterministic)
+  const double alpha[4] = {0.5698402910, 0.7548776662, 0.8566748839, 0.6180339887};
+  double total = 0.0;
+  for (size_t i = 0; i < samples; ++i) {
+    double u[4];
+    for (int d = 0; d < 4; ++d) {
+      u[d] = std::fmod(0.5 + alpha[d] * (i + 1), 1.0);
+    }
+    int club = static_cast<int>(i % (ShotParameterService::NUM_CLUBS - 1));  // Skip the putter
+    double power = layout_.min_power + (layout_.max_power - layout_.min_power) * u[0];
+    double aim = layout_.max_aim_deg * (2.0 * u[1] - 1.0);
+    domain::Vec3 wind(layout_.max_wind_mps * (2.0 * u[2] - 1.0),
+                      layout_.max_wind_mps * (2.0 * u[3] - 1.0), 0.0);
+    
+    LandingEstimate table;
+    lookup(club, power, aim, wind, table);
+    LandingEstimate exact = simulate(club, power, aim, wind);
+    double error = std::hypot(table.x - exact.x, table.y - exact.y);
+    report.max_error_m = std::max(report.max_error_m, error);
+    total += error;
+    ++report.samples;
+  }
+  report.mean_error_m = samples > 0 ? total / samples : 0.0;
+  return report;
+}
+
+uint64_t LandingTable::computeKey() const {
+  domain::Fnv1a h;
+  h.add(TABLE_FORMAT_VERSION);
+  
+  // Physics (wind is a table axis, not part of the key)
+  const domain::PhysicsConfig& c = physics_config_;
+  h.add(c.gravity);
+  // Air as the engine sees it (atmosphere folded in)
+  h.add(c.dragCoefficient());
+  h.add(static_cast<int>(c.aero_model));
+  h.add(c.airDensity());
+  h.add(c.kinematicViscosity());
+  h.add(c.ball_mass_kg);
+  h.add(c.ball_radius_m);
+  h.add(c.spin_decay_time_sec);
+  h.add(c.rk45_rel_tol);
+  h.add(c.rk45_abs_tol);
+  h.add(c.rk45_max_step_sec);
+  h.add(c.dt_fixed_sec);
+  h.add(c.max_flight_time_sec);
+  
+  // Club table
+  for (int i = 0; i < ShotParameterService::NUM_CLUBS; ++i) {
+    const ClubData& club = shot_service_.getClubData(i);
+    h.add(club.name);
+    h.add(club.base_speed_mps);
+    h.add(club.base_angle_deg);
+    h.add(club.base_spin_rpm);
+  }
+  
+  // Grid
+  h.add(layout_.power_points);
+  h.add(layout_.aim_points);
+  h.add(layout_.wind_points);
+  h.add(layout_.min_power);
+  h.add(layout_.max_power);
+  h.add(layout_.max_aim_deg);
+  h.add(layout_.max_wind_mps);
+  return h.value();
+}
+
+size_t LandingTable::tableSize() const {
+  return static_cast<size_t>(ShotParameterService::NUM_CLUBS) * layout_.power_points
+       * layout_.aim_points * layout_.wind_points * layout_.wind_points * VALUES;
+}
+
+size_t LandingTable::index(int club, int ip, int ia, int iwx, int iwy) const {
+  size_t i = static_cast<size_t>(club);
+  i = i * layout_.power_points + ip;
+  i = i * layout_.aim_points + ia;
+  i = i * layout_.wind_points + iwx;
+  i = i * layout_.wind_points + iwy;
+  return i * VALUES;
+}
+
+} // namespace application
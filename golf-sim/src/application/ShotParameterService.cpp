@@ -1,22 +1,63 @@
 #include "application/ShotParameterService.hpp"
+#include "domain/ReferenceFlight.hpp"
 #include <cmath>
 
 namespace application {
 
-const ClubData ShotParameterService::clubs_[6] = {
-  {"Driver",   68.0, 12.0, 250.0},
-  {"3-Wood",   55.0, 15.0, 210.0},
-  {"5-Iron",   48.0, 18.0, 180.0},
-  {"7-Iron",   42.0, 21.0, 155.0},
-  {"9-Iron",   38.0, 24.0, 130.0},
-  {"Putter",    2.0,  0.0,   3.0}
+namespace {
+
+// Still air, spin-aware flight: the conditions the nominal carries describe.
+// RK4 at 1/60 s agrees with 1/240 s to 0.1 mm and keeps the compile-time
+// evaluation cheap.
+constexpr domain::PhysicsConfig nominalConfig() {
+  domain::PhysicsConfig config;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  config.dt_fixed_sec = 1.0 / 60.0;
+  return config;
+}
+
+constexpr ClubData club(const char* name, double speed_mps, double angle_deg,
+                        double distance_avg_m, double spin_rpm) {
+  domain::LaunchCondition launch(speed_mps, angle_deg);
+  launch.initial_spin = domain::Vec3(spin_rpm, 0.0, 0.0);
+  double carry = domain::simulateReferenceFlight(nominalConfig(), launch).carry_m;
+  return ClubData{name, speed_mps, angle_deg, distance_avg_m, spin_rpm, carry};
+}
+
+constexpr ClubData CLUBS[ShotParameterService::NUM_CLUBS] = {
+  club("Driver",   68.0, 12.0, 250.0, 2500.0),
+  club("3-Wood",   55.0, 15.0, 210.0, 3500.0),
+  club("5-Iron",   48.0, 18.0, 180.0, 4000.0),
+  club("7-Iron",   42.0, 21.0, 155.0, 4500.0),
+  club("9-Iron",   38.0, 24.0, 130.0, 5000.0),
+  club("Putter",    2.0,  0.0,   3.0,    0.0)
 };
 
+// Build-time physics regression check: every full swing carries 65-100% of
+// the club's average distance (which includes roll), and the bag is
+// ordered by carry
+constexpr bool nominalCarriesPlausible() {
+  for (int i = 0; i + 1 < ShotParameterService::NUM_CLUBS; ++i) {
+    double ratio = CLUBS[i].nominal_carry_m / CLUBS[i].distance_avg_m;
+    if (ratio < 0.65 || ratio > 1.0) {
+      return false;
+    }
+    if (i > 0 && CLUBS[i].nominal_carry_m >= CLUBS[i - 1].nominal_carry_m) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(nominalCarriesPlausible(), "club nominal carries drifted from the club table");
+
+} // namespace
+
 ShotParameterService::ShotParameterService() {
 }
 
 domain::LaunchCondition ShotParameterService::createLaunchCondition(const ShotParameters& params) const {
-  const ClubData& club = clubs_[params.club_index];
+  const ClubData& club = CLUBS[params.club_index];
   
   domain::LaunchCondition launch;
   launch.launch_speed_mps = club.base_speed_mps * params.power;
@@ -31,14 +72,22 @@ domain::LaunchCondition ShotParameterService::createLaunchCondition(const ShotPa
   launch.initial_velocity.y = launch.launch_speed_mps * std::cos(aim_rad) * std::cos(angle_rad);
   launch.initial_velocity.z = launch.launch_speed_mps * std::sin(angle_rad);
   
+  // Backspin about the horizontal axis perpendicular to the aim line,
+  // tilted by the spin axis (positive tilt adds slice spin, curving right)
+  double spin_rpm = club.base_spin_rpm * params.power;
+  double tilt_rad = params.spin_axis_deg * M_PI / 180.0;
+  launch.initial_spin.x = spin_rpm * std::cos(tilt_rad) * std::cos(aim_rad);
+  launch.initial_spin.y = -spin_rpm * std::cos(tilt_rad) * std::sin(aim_rad);
+  launch.initial_spin.z = -spin_rpm * std::sin(tilt_rad);
+  
   return launch;
 }
 
 const ClubData& ShotParameterService::getClubData(int index) const {
   if (index < 0 || index >= NUM_CLUBS) {
-    return clubs_[0];
+    return CLUBS[0];
   }
-  return clubs_[index];
+  return CLUBS[index];
 }
 
 } // namespace application
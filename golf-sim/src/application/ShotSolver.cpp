@@ -0,0 +1,136 @@
+#include "application/ShotSolver.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace application {
+
+namespace {
+
+double bearingDeg(double x, double y) {
+  return std::atan2(x, y) * 180.0 / M_PI;
+}
+
+} // namespace
+
+ShotSolver::ShotSolver(const ShotParameterService& shot_service,
+                       const domain::PhysicsConfig& physics_config)
+  : shot_service_(shot_service)
+  , physics_config_(domain::headlessLandingConfig(physics_config))
+  , engine_(physics_config_) {
+}
+
+void ShotSolver::setWindField(std::shared_ptr<const domain::WindField> field) {
+  wind_field_ = std::move(field);
+  engine_.setWindField(wind_field_.get());
+  invalidate();
+}
+
+domain::Vec3 ShotSolver::simulate(const ShotParameters& params) {
+  engine_.startShot(shot_service_.createLaunchCondition(params));
+  engine_.step(physics_config_.max_flight_time_sec);
+  return engine_.calculateResult().landing_position;
+}
+
+ShotSolution ShotSolver::solve(int club_index, const ShotTarget& target, float spin_axis_deg) {
+  const double target_range = std::hypot(target.distance_m, target.lateral_m);
+  const double target_bearing = bearingDeg(target.lateral_m, target.distance_m);
+  
+  ShotParameters params;
+  params.club_index = club_index;
+  params.spin_axis_deg = spin_axis_deg;
+  bool warm = warm_valid_ && warm_club_ == club_index;
+  if (warm) {
+    params.power = warm_power_;
+  } else {
+    // Cold start from the club's baked full-power carry (range ~ power^2)
+    double nominal = shot_service_.getClubData(club_index).nominal_carry_m;
+    double guess = nominal > 0.0 ? std::sqrt(target_range / nominal) : 1.0;
+    params.power = static_cast<float>(std::max<double>(MIN_POWER, std::min<double>(MAX_POWER, guess)));
+  }
+  params.aim_angle_deg = warm ? warm_aim_deg_
+                              : std::max(-MAX_AIM_DEG, std::min(MAX_AIM_DEG, static_cast<float>(target_bearing)));
+  
+  ShotSolution solution;
+  
+  // Bracket on power: range(lo) < target < range(hi)
+  float lo = MIN_POWER;
+  float hi = MAX_POWER;
+  bool have_prev = false;
+  float prev_power = 0.0f;
+  double prev_error = 0.0;
+  double slope = warm ? warm_slope_ : 0.0;  // d range / d power
+  
+  for (int iter = 0; iter < MAX_ITERATIONS; ++iter) {
+    domain::Vec3 landing = simulate(params);
+    ++solution.simulations;
+    solution.power = params.power;
+    solution.aim_angle_deg = params.aim_angle_deg;
+    solution.landing = landing;
+    
+    double range_error = std::hypot(landing.x, landing.y) - target_range;
+    double miss = std::hypot(landing.x - target.lateral_m, landing.y - target.distance_m);
+    if (miss < TOLERANCE_M) {
+      solution.status = ShotSolution::Status::Solved;
+      break;
+    }
+    
+    if (range_error < 0.0) {
+      lo = std::max(lo, params.power);
+    } else {
+      hi = std::min(hi, params.power);
+    }
+    if (range_error < 0.0 && params.power >= MAX_POWER) {
+      solution.status = ShotSolution::Status::TooLong;
+      break;
+    }
+    if (range_error > 0.0 && params.power <= MIN_POWER) {
+      solution.status = ShotSolution::Status::TooShort;
+      break;
+    }
+    
+    // Secant on range, kept inside the bracket
+    float next_power;
+    if (have_prev && params.power != prev_power && range_error != prev_error) {
+      slope = (range_error - prev_error) / (params.power - prev_power);
+    }
+    if (slope > 0.0) {
+      next_power = static_cast<float>(params.power - range_error / slope);
+    } else {
+      // First step: range grows roughly with power squared
+      double range = range_error + target_range;
+      double scale = range > 1e-3 ? std::sqrt(target_range / range) : 2.0;
+      next_power = static_cast<float>(params.power * scale);
+    }
+    if (next_power >= MAX_POWER && hi == MAX_POWER && params.power != MAX_POWER) {
+      next_power = MAX_POWER;  // Probe full power before bisecting toward it
+    } else if (next_power <= MIN_POWER && lo == MIN_POWER && params.power != MIN_POWER) {
+      next_power = MIN_POWER;  // Same at the bottom of the range
+    } else if (!(next_power > lo && next_power < hi)) {
+      next_power = 0.5f * (lo + hi);
+    }
+    
+    // Bearing error maps almost one to one onto aim
+    double bearing_error = target_bearing - bearingDeg(landing.x, landing.y);
+    float next_aim = static_cast<float>(params.aim_angle_deg + bearing_error);
+    if (std::abs(next_aim) > MAX_AIM_DEG && std::abs(params.aim_angle_deg) >= MAX_AIM_DEG) {
+      break;  // Already aiming as far as allowed and still off line: NotConverged
+    }
+    next_aim = std::max(-MAX_AIM_DEG, std::min(MAX_AIM_DEG, next_aim));
+    
+    prev_power = params.power;
+    prev_error = range_error;
+    have_prev = true;
+    params.power = next_power;
+    params.aim_angle_deg = next_aim;
+  }
+  
+  warm_valid_ = true;
+  warm_club_ = club_index;
+  warm_power_ = solution.power;
+  warm_aim_deg_ = solution.aim_angle_deg;
+  warm_slope_ = slope;
+  return solution;
+}
+
+} // namespace application
@@ -0,0 +1,132 @@
+#include "application/SimulationThread.hpp"
+#include <chrono>
+
+namespace application {
+
+SimulationThread::SimulationThread(domain::GameStateMachine& state_machine,
+                                   domain::PhysicsEngine& physics,
+                                   ExecuteShotUseCase& execute_shot,
+                                   UpdatePhysicsUseCase& update_physics,
+                                   const SimulationConfig& config)
+  : state_machine_(state_machine)
+  , physics_(physics)
+  , execute_shot_(execute_shot)
+  , update_physics_(update_physics)
+  , config_(config) {
+  if (!(config_.rate_hz > 0.0)) {
+    config_.rate_hz = 240.0;
+  }
+  publish();
+}
+
+SimulationThread::~SimulationThread() {
+  stop();
+}
+
+void SimulationThread::start() {
+  if (running_.exchange(true)) {
+    return;
+  }
+  thread_ = std::thread([this] { run(); });
+}
+
+void SimulationThread::stop() {
+  running_.store(false);
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void SimulationThread::post(const SimulationCommand& command) {
+  std::lock_guard<std::mutex> lock(command_mutex_);
+  pending_.push_back(command);
+}
+
+void SimulationThread::advance(double dt) {
+  tick(dt);
+}
+
+const SimulationSnapshot& SimulationThread::latest() {
+  snapshots_.acquire();
+  return snapshots_.readBuffer();
+}
+
+void SimulationThread::run() {
+  using Clock = std::chrono::steady_clock;
+  const auto period = std::chrono::duration_cast<Clock::duration>(
+    std::chrono::duration<double>(1.0 / config_.rate_hz));
+  const double dt = 1.0 / config_.rate_hz;
+  
+  auto next = Clock::now() + period;
+  while (running_.load(std::memory_order_relaxed)) {
+    std::this_thread::sleep_until(next);
+    
+    // Ticks that are due; after a stall run a few back to back, then let
+    // simulated time slip instead of spiralling
+    int due = 0;
+    auto now = Clock::now();
+    while (next <= now && due < config_.max_catch_up_ticks) {
+      tick(dt);
+      next += period;
+      ++due;
+    }
+    if (due > 1) {
+      late_ticks_.fetch_add(static_cast<uint64_t>(due - 1), std::memory_order_relaxed);
+    }
+    if (next <= now) {
+      auto behind = (now - next) / period + 1;
+      dropped_ticks_.fetch_add(static_cast<uint64_t>(behind), std::memory_order_relaxed);
+      next += behind * period;
+    }
+  }
+}
+
+void SimulationThread::tick(double dt) {
+  applyCommands();
+  update_physics_.update(dt);
+  sim_time_sec_ += dt;
+  ++tick_index_;
+  publish();
+  ticks_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SimulationThread::applyCommands() {
+  {
+    std::lock_guard<std::mutex> lock(command_mutex_);
+    applying_.swap(pending_);
+  }
+  for (const SimulationCommand& command : applying_) {
+    switch (command.type) {
+      case SimulationCommand::Type::Arm:
+        state_machine_.transitionToArmed();
+        break;
+      case SimulationCommand::Type::Shoot:
+        physics_.setWindField(wind_field_.get(), command.wind_time_offset_sec);
+        execute_shot_.execute(command.params);
+        break;
+      case SimulationCommand::Type::NextHole:
+        physics_.reset();
+        state_machine_.transitionToIdle();
+        wind_field_ = command.wind_field;
+        physics_.setWindField(wind_field_.get());
+        break;
+    }
+  }
+  applying_.clear();
+}
+
+void SimulationThread::publish() {
+  SimulationSnapshot& s = snapshots_.writeBuffer();
+  s.tick = tick_index_;
+  s.sim_time_sec = sim_time_sec_;
+  s.game_state = state_machine_.getCurrentState();
+  s.ball = physics_.getInterpolatedState();
+  CoordinateConverter::toRenderTrajectory(physics_.getTrajectory(), s.ball.t_sec, s.trail);
+  s.result_available = physics_.isResultAvailable();
+  if (s.result_available) {
+    s.result = physics_.calculateResult();
+  }
+  snapshots_.publish();
+}
+
+} // namespace application
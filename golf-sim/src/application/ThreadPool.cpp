@@ -0,0 +1,89 @@
+#include "application/ThreadPool.hpp"
+
+namespace application {
+
+ThreadPool::ThreadPool(size_t threads) {
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+  }
+  threads = threads > 0 ? threads : 1;
+  
+  workers_.reserve(threads - 1);
+  for (size_t i = 1; i < threads; ++i) {
+    workers_.emplace_back(&ThreadPool::workerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& fn) {
+  if (count == 0) {
+    return;
+  }
+  if (workers_.empty() || count == 1) {
+    for (size_t i = 0; i < count; ++i) {
+      fn(i);
+    }
+    return;
+  }
+  
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = &fn;
+    job_count_ = count;
+    next_index_.store(0, std::memory_order_relaxed);
+    busy_workers_ = workers_.size();
+    ++generation_;
+  }
+  wake_.notify_all();
+  
+  runIndices(fn, count);
+  
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [this] { return busy_workers_ == 0; });
+  job_ = nullptr;
+}
+
+void ThreadPool::workerLoop() {
+  unsigned long seen = 0;
+  for (;;) {
+    const std::function<void(size_t)>* job;
+    size_t count;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock, [this, seen] { return stopping_ || generation_ != seen; });
+      if (stopping_) {
+        return;
+      }
+      seen = generation_;
+      job = job_;
+      count = job_count_;
+    }
+    
+    runIndices(*job, count);
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--busy_workers_ == 0) {
+      done_.notify_one();
+    }
+  }
+}
+
+void ThreadPool::runIndices(const std::function<void(size_t)>& fn, size_t count) {
+  // Claim indices one at a time so uneven work still balances
+  for (size_t i = next_index_.fetch_add(1, std::memory_order_relaxed); i < count;
+       i = next_index_.fetch_add(1, std::memory_order_relaxed)) {
+    fn(i);
+  }
+}
+
+} // namespace application
@@ -40,8 +40,8 @@ void UpdatePhysicsUseCase::update(double dt) {
   // Update physics
   physics_.step(dt);
   
-  // Check for landing
-  if (physics_.hasLanded()) {
+  // Shot is over once the ball has bounced and rolled to a stop
+  if (physics_.isAtRest()) {
     state_machine_.transitionToResult();
   }
 }
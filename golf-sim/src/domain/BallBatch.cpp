@@ -0,0 +1,201 @@
+#include "domain/BallBatch.hpp"
+#include "domain/PhysicsEngine.hpp"
+#include "domain/SimdMath.hpp"
+
+namespace domain {
+
+namespace {
+
+using namespace simd;
+
+// Cubic Hermite value and d/du on u in [0, 1] (m0, m1 are end slopes times h)
+inline F4 hermite4(F4 u, F4 p0, F4 m0, F4 p1, F4 m1) {
+  F4 u2 = mul4(u, u);
+  F4 u3 = mul4(u2, u);
+  F4 two = splat4(2.0f);
+  F4 three = splat4(3.0f);
+  F4 h01 = sub4(mul4(three, u2), mul4(two, u3));
+  F4 h10 = add4(sub4(u3, mul4(two, u2)), u);
+  F4 h11 = sub4(u3, u2);
+  // h00 = 1 - h01
+  return add4(add4(p0, mul4(h01, sub4(p1, p0))), add4(mul4(h10, m0), mul4(h11, m1)));
+}
+
+inline F4 hermiteSlope4(F4 u, F4 p0, F4 m0, F4 p1, F4 m1) {
+  F4 u2 = mul4(u, u);
+  F4 six_u_u2 = mul4(splat4(6.0f), sub4(u, u2));
+  F4 d10 = add4(sub4(mul4(splat4(3.0f), u2), mul4(splat4(4.0f), u)), splat4(1.0f));
+  F4 d11 = sub4(mul4(splat4(3.0f), u2), mul4(splat4(2.0f), u));
+  return add4(mul4(six_u_u2, sub4(p1, p0)), add4(mul4(d10, m0), mul4(d11, m1)));
+}
+
+} // namespace
+
+BallBatch::BallBatch(const PhysicsConfig& config)
+  : config_(config)
+  , drag_coefficient_(config.dragCoefficient()) {
+}
+
+void BallBatch::clear() {
+  count_ = 0;
+  t_sec_ = 0.0;
+}
+
+void BallBatch::reserveFor(size_t count) {
+  size_t padded = (count + LANES - 1) / LANES * LANES;
+  if (padded <= px_.size()) {
+    return;
+  }
+  size_t grown = padded < 2 * px_.size() ? 2 * px_.size() : padded;
+  for (auto* column : {&px_, &py_, &pz_, &vx_, &vy_, &vz_, &sx_, &sy_, &sz_,
+                       &land_x_, &land_y_, &land_t_}) {
+    column->resize(grown, 0.0f);
+  }
+  // Padding lanes stay retired
+  active_.resize(grown, 0u);
+}
+
+size_t BallBatch::add(const LaunchCondition& launch) {
+  size_t i = count_;
+  reserveFor(i + 1);
+  
+  Vec3 vel = PhysicsEngine::launchVelocity(launch);
+  px_[i] = 0.0f;
+  py_[i] = 0.0f;
+  pz_[i] = 0.0f;
+  vx_[i] = static_cast<float>(vel.x);
+  vy_[i] = static_cast<float>(vel.y);
+  vz_[i] = static_cast<float>(vel.z);
+  sx_[i] = static_cast<float>(launch.initial_spin.x);
+  sy_[i] = static_cast<float>(launch.initial_spin.y);
+  sz_[i] = static_cast<float>(launch.initial_spin.z);
+  land_x_[i] = 0.0f;
+  land_y_[i] = 0.0f;
+  land_t_[i] = 0.0f;
+  active_[i] = 0xFFFFFFFFu;
+  
+  count_ = i + 1;
+  return i;
+}
+
+bool BallBatch::step() {
+  const double dt_d = config_.dt_fixed_sec;
+  t_sec_ += dt_d;
+  
+  const F4 dt = splat4(static_cast<float>(dt_d));
+  const F4 neg_k = splat4(static_cast<float>(-drag_coefficient_));
+  const F4 neg_g = splat4(static_cast<float>(-config_.gravity));
+  const Vec3x4 wind = splat3(static_cast<float>(config_.wind_velocity.x),
+                             static_cast<float>(config_.wind_velocity.y),
+                             static_cast<float>(config_.wind_velocity.z));
+  const F4 zero = splat4(0.0f);
+  const F4 now = splat4(static_cast<float>(t_sec_));
+  // Same launch guard as PhysicsEngine (ignore ground contact right at impact)
+  const M4 can_land = splatMask(t_sec_ > 0.01);
+  
+  bool still_flying = false;
+  for (size_t i = 0; i < count_; i += LANES) {
+    M4 active = loadMask(&active_[i]);
+    if (!any(active)) {
+      continue;  // Whole group retired
+    }
+    
+    F4 px = load4(&px_[i]);
+    F4 py = load4(&py_[i]);
+    F4 pz = load4(&pz_[i]);
+    F4 vx = load4(&vx_[i]);
+    F4 vy = load4(&vy_[i]);
+    F4 vz = load4(&vz_[i]);
+    
+    // Drag: a_d = -k * |v_rel| * v_rel
+    Vec3x4 rel = sub(Vec3x4{vx, vy, vz}, wind);
+    Vec3x4 drag = scale(rel, mul4(neg_k, length(rel)));
+    
+    // Explicit Euler, matching PhysicsEngine::integrate
+    F4 nvx = add4(vx, mul4(drag.x, dt));
+    F4 nvy = add4(vy, mul4(drag.y, dt));
+    F4 nvz = add4(vz, mul4(add4(drag.z, neg_g), dt));
+    F4 npx = add4(px, mul4(nvx, dt));
+    F4 npy = add4(py, mul4(nvy, dt));
+    F4 npz = add4(pz, mul4(nvz, dt));
+    
+    // Retired lanes keep their state
+    store4(&vx_[i], select4(active, nvx, vx));
+    store4(&vy_[i], select4(active, nvy, vy));
+    store4(&vz_[i], select4(active, nvz, vz));
+    store4(&px_[i], select4(active, npx, px));
+    store4(&py_[i], select4(active, npy, py));
+    store4(&pz_[i], select4(active, npz, pz));
+    
+    M4 landed = both(both(active, lessEqual(npz, zero)), can_land);
+    if (any(landed)) {
+      // Touchdown inside the step: Newton on the Hermite height, starting
+      // from the linear crossing; lanes that started on the ground keep u = 1
+      F4 mz0 = mul4(vz, dt);
+      F4 mz1 = mul4(nvz, dt);
+      F4 one = splat4(1.0f);
+      F4 u = min4(one, max4(zero, div4(pz, max4(sub4(pz, npz), splat4(1e-12f)))));
+      for (int iter = 0; iter < 3; ++iter) {
+        F4 f = hermite4(u, pz, mz0, npz, mz1);
+        F4 df = min4(hermiteSlope4(u, pz, mz0, npz, mz1), splat4(-1e-12f));
+        u = min4(one, max4(zero, sub4(u, div4(f, df))));
+      }
+      u = select4(greater(pz, zero), u, one);
+      
+      F4 tx = hermite4(u, px, mul4(vx, dt), npx, mul4(nvx, dt));
+      F4 ty = hermite4(u, py, mul4(vy, dt), npy, mul4(nvy, dt));
+      F4 tt = sub4(now, mul4(sub4(one, u), dt));
+      store4(&land_x_[i], select4(landed, tx, load4(&land_x_[i])));
+      store4(&land_y_[i], select4(landed, ty, load4(&land_y_[i])));
+      store4(&land_t_[i], select4(landed, tt, load4(&land_t_[i])));
+    }
+    
+    active = clearBits(active, landed);
+    storeMask(&active_[i], active);
+    still_flying = still_flying || any(active);
+  }
+  
+  return still_flying;
+}
+
+void BallBatch::run() {
+  while (t_sec_ < config_.max_flight_time_sec) {
+    if (!step()) {
+      break;
+    }
+  }
+}
+
+size_t BallBatch::activeCount() const {
+  size_t n = 0;
+  for (size_t i = 0; i < count_; ++i) {
+    n += active_[i] != 0 ? 1 : 0;
+  }
+  return n;
+}
+
+bool BallBatch::isInFlight(size_t index) const {
+  return index < count_ && active_[index] != 0;
+}
+
+ShotResult BallBatch::getResult(size_t index) const {
+  ShotResult result;
+  if (index >= count_) {
+    return result;
+  }
+  
+  // Balls stopped by the flight time cap report where they are
+  bool landed = active_[index] == 0;
+  double x = landed ? land_x_[index] : px_[index];
+  double y = landed ? land_y_[index] : py_[index];
+  
+  result.carry_m = Vec3(x, y, 0.0).length();
+  result.total_m = result.carry_m;
+  result.lateral_m = x;
+  result.flight_time_s = landed ? static_cast<double>(land_t_[index]) : t_sec_;
+  result.landing_position = Vec3(x, y, 0.0);
+  result.rest_position = result.landing_position;
+  return result;
+}
+
+} // namespace domain
@@ -1,114 +1,708 @@
 #include "domain/PhysicsEngine.hpp"
+#include "domain/AeroCoefficients.hpp"
+#include <algorithm>
 #include <cmath>
+#include <type_traits>
 
 namespace domain {
 
-PhysicsEngine::PhysicsEngine(const PhysicsConfig& config)
-  : config_(config) {
+namespace {
+
+// Dormand-Prince 5(4) coefficients
+constexpr double C2 = 1.0 / 5.0, C3 = 3.0 / 10.0, C4 = 4.0 / 5.0, C5 = 8.0 / 9.0;
+constexpr double A21 = 1.0 / 5.0;
+constexpr double A31 = 3.0 / 40.0, A32 = 9.0 / 40.0;
+constexpr double A41 = 44.0 / 45.0, A42 = -56.0 / 15.0, A43 = 32.0 / 9.0;
+constexpr double A51 = 19372.0 / 6561.0, A52 = -25360.0 / 2187.0, A53 = 64448.0 / 6561.0,
+                 A54 = -212.0 / 729.0;
+constexpr double A61 = 9017.0 / 3168.0, A62 = -355.0 / 33.0, A63 = 46732.0 / 5247.0,
+                 A64 = 49.0 / 176.0, A65 = -5103.0 / 18656.0;
+// 5th-order weights (also row 7 of the tableau, hence FSAL)
+constexpr double B1 = 35.0 / 384.0, B3 = 500.0 / 1113.0, B4 = 125.0 / 192.0,
+                 B5 = -2187.0 / 6784.0, B6 = 11.0 / 84.0;
+// Difference between the 5th- and embedded 4th-order weights
+constexpr double E1 = 71.0 / 57600.0, E3 = -71.0 / 16695.0, E4 = 71.0 / 1920.0,
+                 E5 = -17253.0 / 339200.0, E6 = 22.0 / 525.0, E7 = -1.0 / 40.0;
+// Dense output (Hairer & Wanner, DOPRI5 contd5)
+constexpr double D1 = -12715105075.0 / 11282082432.0, D3 = 87487479700.0 / 32700410799.0,
+                 D4 = -10690763975.0 / 1880347072.0, D5 = 701980252875.0 / 199316789632.0,
+                 D6 = -1453857185.0 / 822651844.0, D7 = 69997945.0 / 29380423.0;
+
+constexpr double RK45_INITIAL_STEP_SEC = 0.01;
+constexpr double RK45_MIN_STEP_SEC = 1e-9;
+
+constexpr double RPM_TO_RAD_PER_SEC = 2.0 * M_PI / 60.0;
+
+// Cubic Hermite interpolation of position (and its derivative for velocity)
+// between two states one step apart; exact for constant acceleration
+template <typename S>
+BasicBallState<S> hermite(const BasicBallState<S>& a, const BasicBallState<S>& b, S t) {
+  S h = b.t_sec - a.t_sec;
+  S u = h > S(0) ? (t - a.t_sec) / h : S(0);
+  S u2 = u * u;
+  S u3 = u2 * u;
+  
+  S h00 = S(2) * u3 - S(3) * u2 + S(1);
+  S h10 = u3 - S(2) * u2 + u;
+  S h01 = S(-2) * u3 + S(3) * u2;
+  S h11 = u3 - u2;
+  // d/dt of the basis (already divided by h)
+  S d00 = h > S(0) ? (S(6) * u2 - S(6) * u) / h : S(0);
+  S d10 = S(3) * u2 - S(4) * u + S(1);
+  S d01 = h > S(0) ? (S(-6) * u2 + S(6) * u) / h : S(0);
+  S d11 = S(3) * u2 - S(2) * u;
+  
+  BasicBallState<S> s = a;
+  s.t_sec = t;
+  s.pos = a.pos * h00 + a.vel * (h10 * h) + b.pos * h01 + b.vel * (h11 * h);
+  s.vel = a.pos * d00 + a.vel * d10 + b.pos * d01 + b.vel * d11;
+  s.spin = a.spin + (b.spin - a.spin) * u;
+  return s;
+}
+
+// Touchdown time in [lo, hi] given z(lo) > 0 >= z(hi), by bisection on
+// the interpolated height
+template <typename S, typename Interpolant>
+S findTouchdownTime(S lo, S hi, const Interpolant& at) {
+  for (int i = 0; i < 60 && hi - lo > S(1e-12); ++i) {
+    S mid = S(0.5) * (lo + hi);
+    if (at(mid).pos.z > S(0)) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return hi;
+}
+
+template <typename S>
+S scaledError(S err, S y0, S y1, S atol, S rtol) {
+  S scale = atol + rtol * std::max(std::abs(y0), std::abs(y1));
+  return (err / scale) * (err / scale);
+}
+
+} // namespace
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::BasicPhysicsEngine(const PhysicsConfig& config)
+  : config_(config)
+  , trajectory_(config.max_trajectory_points) {
+  double area = M_PI * config_.ball_radius_m * config_.ball_radius_m;
+  dt_fixed_ = static_cast<Scalar>(config_.dt_fixed_sec);
+  gravity_ = static_cast<Scalar>(config_.gravity);
+  // Air properties (fixed or from the atmosphere) folded in once
+  drag_coefficient_ = static_cast<Scalar>(config_.dragCoefficient());
+  wind_ = Vec(config_.wind_velocity);
+  ball_radius_ = static_cast<Scalar>(config_.ball_radius_m);
+  aero_k_ = static_cast<Scalar>(config_.airDensity() * area / (2.0 * config_.ball_mass_kg));
+  reynolds_per_speed_ = static_cast<Scalar>(2.0 * config_.ball_radius_m / config_.kinematicViscosity());
+  spin_decay_rate_ = static_cast<Scalar>(
+    config_.spin_decay_time_sec > 0.0 ? 1.0 / config_.spin_decay_time_sec : 0.0);
   reset();
 }
 
-void PhysicsEngine::startShot(const LaunchCondition& launch) {
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+Vec3 BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::launchVelocity(const LaunchCondition& launch) {
+  // Explicit velocity vector (carries aim) takes precedence
+  const Vec3& v = launch.initial_velocity;
+  if (v.x != 0.0 || v.y != 0.0 || v.z != 0.0) {
+    return v;
+  }
+  
   // Convert launch angle and speed to velocity vector
   double angle_rad = launch.launch_angle_deg * M_PI / 180.0;
   
   // Initial velocity (assuming shot is in +y direction)
-  current_state_.vel.x = 0.0;
-  current_state_.vel.y = launch.launch_speed_mps * std::cos(angle_rad);
-  current_state_.vel.z = launch.launch_speed_mps * std::sin(angle_rad);
-  
-  current_state_.pos = Vec3(0.0, 0.0, 0.0);  // Start at origin
-  current_state_.t_sec = 0.0;
-  current_state_.spin = launch.initial_spin;
+  return Vec3(0.0,
+              launch.launch_speed_mps * std::cos(angle_rad),
+              launch.launch_speed_mps * std::sin(angle_rad));
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+void BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::startShot(const LaunchCondition& launch) {
+  current_state_.vel = Vec(launchVelocity(launch));
+  current_state_.pos = Vec(0, 0, 0);  // Start at origin
+  current_state_.t_sec = Scalar(0);
+  current_state_.spin = Vec(launch.initial_spin);
   current_state_.in_flight = true;
   
   initial_position_ = current_state_.pos;
   trajectory_.clear();
-  trajectory_.addPoint(current_state_);
+  record(current_state_);
   accumulator_ = 0.0;
+  playback_t_ = 0.0;
+  result_available_ = false;
+  rest_available_ = false;
+  phase_ = Phase::Flight;
+  force_evaluations_ = 0;
+  adaptive_h_ = static_cast<Scalar>(std::min(RK45_INITIAL_STEP_SEC, config_.rk45_max_step_sec));
+  fsal_valid_ = false;
+  output_index_ = 1;
+  dense_valid_ = false;
+  
+  if (config_.precompute_flight) {
+    precomputeFlight();
+  }
+  previous_state_ = current_state_;
+  last_step_sec_ = 0.0;
 }
 
-void PhysicsEngine::step(double dt_real) {
-  if (!current_state_.in_flight) {
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+void BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::step(double dt_real) {
+  if (phase_ == Phase::Rest) {
+    // An RK45 flight can land ahead of the clock; let the drawn ball finish
+    accumulator_ = std::min(0.0, accumulator_ + dt_real);
+    return;
+  }
+  
+  if (config_.precompute_flight) {
+    advancePlayback(dt_real);
+    previous_state_ = current_state_;
     return;
   }
   
-  // Accumulator pattern for fixed timestep
+  // Accumulator pattern; the step sequence depends only on the state, so
+  // results do not depend on how real time is chunked into frames
   accumulator_ += dt_real;
   
-  while (accumulator_ >= config_.dt_fixed_sec) {
-    integrate(config_.dt_fixed_sec);
-    accumulator_ -= config_.dt_fixed_sec;
+  // RK45 steps may span many frames: take the step that covers the current
+  // time now (leaving the accumulator in (-h, 0]) and draw from its dense
+  // output, rather than waiting for a whole step of real time
+  const bool adaptive = integrator() == PhysicsConfig::Integrator::RK45;
+  while (phase_ == Phase::Flight && (adaptive ? accumulator_ > 0.0 : accumulator_ >= nextStepSize())) {
+    previous_state_ = current_state_;
+    Scalar t_before = current_state_.t_sec;
+    bool landed = advanceStep();
+    last_step_sec_ = integrator() == PhysicsConfig::Integrator::RK45
+                       ? static_cast<double>(current_state_.t_sec - t_before)
+                       : static_cast<double>(dt_fixed_);
+    accumulator_ -= last_step_sec_;
+    if (landed) {
+      if (adaptive) {
+        // The ground phase starts from the touchdown, not the step start
+        previous_state_ = current_state_;
+      }
+      break;
+    }
+  }
+  
+  while (phase_ == Phase::Ground && accumulator_ >= config_.ground_dt_sec) {
+    previous_state_ = current_state_;
+    accumulator_ -= config_.ground_dt_sec;
+    last_step_sec_ = config_.ground_dt_sec;
+    advanceGroundStep();
+  }
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+double BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::getInterpolationAlpha() const {
+  if (config_.precompute_flight || phase_ == Phase::Rest || last_step_sec_ <= 0.0) {
+    return 1.0;
+  }
+  return std::min(1.0, std::max(0.0, accumulator_ / last_step_sec_));
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+auto BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::getInterpolatedState() const -> State {
+  if (dense_valid_ && !config_.precompute_flight &&
+      (accumulator_ < 0.0 || phase_ == Phase::Flight)) {
+    // RK45 ahead of the clock: the ball is on the last step's dense output
+    Scalar t = current_state_.t_sec + static_cast<Scalar>(accumulator_);
+    t = std::min(last_dense_.t0 + last_dense_.h, std::max(last_dense_.t0, t));
+    return last_dense_.at(t);
+  }
+  
+  double alpha = getInterpolationAlpha();
+  if (alpha >= 1.0) {
+    return current_state_;
+  }
+  Scalar a = static_cast<Scalar>(alpha);
+  State s = current_state_;
+  s.t_sec = previous_state_.t_sec + (current_state_.t_sec - previous_state_.t_sec) * a;
+  s.pos = previous_state_.pos + (current_state_.pos - previous_state_.pos) * a;
+  s.vel = previous_state_.vel + (current_state_.vel - previous_state_.vel) * a;
+  s.spin = previous_state_.spin + (current_state_.spin - previous_state_.spin) * a;
+  return s;
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+double BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::nextStepSize() const {
+  return integrator() == PhysicsConfig::Integrator::RK45 ? adaptive_h_ : dt_fixed_;
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+bool BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::advanceStep() {
+  if (integrator() == PhysicsConfig::Integrator::RK45) {
+    return advanceAdaptiveStep();
+  }
+  return advanceFixedStep();
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+bool BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::advanceFixedStep() {
+  const State before = current_state_;
+  integrate(dt_fixed_);
+  
+  // Check landing condition
+  if (current_state_.pos.z <= Scalar(0) && current_state_.t_sec > Scalar(0.01)) {
+    State touchdown = current_state_;
+    if (before.pos.z > Scalar(0)) {
+      // Locate the crossing inside the step instead of snapping to its end
+      const State after = current_state_;
+      auto at = [&before, &after](Scalar t) { return hermite(before, after, t); };
+      touchdown = at(findTouchdownTime(before.t_sec, after.t_sec, at));
+    }
+    touchdown.pos.z = Scalar(0);
+    land(touchdown);
+    return true;
+  }
+  
+  // Store trajectory point (decimated by Trajectory beyond its budget)
+  record(current_state_);
+  return false;
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+bool BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::advanceAdaptiveStep() {
+  const State s0 = current_state_;
+  if (!fsal_valid_) {
+    fsal_ = evaluate(s0);
+    fsal_valid_ = true;
+  }
+  const Derivative k1 = fsal_;
+  
+  auto stage = [&s0](Scalar h, Scalar c, const Vec& dpos, const Vec& dvel, const Vec& dspin) {
+    State s = s0;
+    s.t_sec = s0.t_sec + c * h;
+    s.pos = s0.pos + dpos * h;
+    s.vel = s0.vel + dvel * h;
+    s.spin = s0.spin + dspin * h;
+    return s;
+  };
+  
+  Scalar h = adaptive_h_;
+  for (;;) {
+    Derivative k2 = evaluate(stage(h, C2, k1.dpos * A21, k1.dvel * A21, k1.dspin * A21));
+    Derivative k3 = evaluate(stage(h, C3,
+      k1.dpos * A31 + k2.dpos * A32,
+      k1.dvel * A31 + k2.dvel * A32,
+      k1.dspin * A31 + k2.dspin * A32));
+    Derivative k4 = evaluate(stage(h, C4,
+      k1.dpos * A41 + k2.dpos * A42 + k3.dpos * A43,
+      k1.dvel * A41 + k2.dvel * A42 + k3.dvel * A43,
+      k1.dspin * A41 + k2.dspin * A42 + k3.dspin * A43));
+    Derivative k5 = evaluate(stage(h, C5,
+      k1.dpos * A51 + k2.dpos * A52 + k3.dpos * A53 + k4.dpos * A54,
+      k1.dvel * A51 + k2.dvel * A52 + k3.dvel * A53 + k4.dvel * A54,
+      k1.dspin * A51 + k2.dspin * A52 + k3.dspin * A53 + k4.dspin * A54));
+    Derivative k6 = evaluate(stage(h, Scalar(1),
+      k1.dpos * A61 + k2.dpos * A62 + k3.dpos * A63 + k4.dpos * A64 + k5.dpos * A65,
+      k1.dvel * A61 + k2.dvel * A62 + k3.dvel * A63 + k4.dvel * A64 + k5.dvel * A65,
+      k1.dspin * A61 + k2.dspin * A62 + k3.dspin * A63 + k4.dspin * A64 + k5.dspin * A65));
+    State s1 = stage(h, Scalar(1),
+      k1.dpos * B1 + k3.dpos * B3 + k4.dpos * B4 + k5.dpos * B5 + k6.dpos * B6,
+      k1.dvel * B1 + k3.dvel * B3 + k4.dvel * B4 + k5.dvel * B5 + k6.dvel * B6,
+      k1.dspin * B1 + k3.dspin * B3 + k4.dspin * B4 + k5.dspin * B5 + k6.dspin * B6);
+    Derivative k7 = evaluate(s1);
+    
+    // Embedded error estimate, RMS over position and velocity components
+    // (spin decays smoothly and does not drive the step size)
+    Vec ep = (k1.dpos * E1 + k3.dpos * E3 + k4.dpos * E4 + k5.dpos * E5 + k6.dpos * E6 + k7.dpos * E7) * h;
+    Vec ev = (k1.dvel * E1 + k3.dvel * E3 + k4.dvel * E4 + k5.dvel * E5 + k6.dvel * E6 + k7.dvel * E7) * h;
+    const Scalar atol = static_cast<Scalar>(config_.rk45_abs_tol);
+    const Scalar rtol = static_cast<Scalar>(config_.rk45_rel_tol);
+    Scalar sum = scaledError(ep.x, s0.pos.x, s1.pos.x, atol, rtol)
+               + scaledError(ep.y, s0.pos.y, s1.pos.y, atol, rtol)
+               + scaledError(ep.z, s0.pos.z, s1.pos.z, atol, rtol)
+               + scaledError(ev.x, s0.vel.x, s1.vel.x, atol, rtol)
+               + scaledError(ev.y, s0.vel.y, s1.vel.y, atol, rtol)
+               + scaledError(ev.z, s0.vel.z, s1.vel.z, atol, rtol);
+    Scalar err = std::sqrt(sum / Scalar(6));
+    
+    Scalar factor = err > Scalar(0) ? Scalar(0.9) * std::pow(err, Scalar(-0.2)) : Scalar(5);
+    factor = std::min(Scalar(5), std::max(Scalar(0.2), factor));
+    
+    const Scalar min_step = static_cast<Scalar>(RK45_MIN_STEP_SEC);
+    if (err > Scalar(1) && h > min_step) {
+      h = std::max(min_step, h * factor);  // Rejected: retry smaller
+      continue;
+    }
+    
+    // Accepted: build the continuous extension over [t0, t0 + h]
+    DenseStep dense;
+    dense.t0 = s0.t_sec;
+    dense.h = h;
+    dense.pos[0] = s0.pos;
+    dense.vel[0] = s0.vel;
+    dense.spin0 = s0.spin;
+    dense.spin1 = s1.spin;
+    dense.pos[1] = s1.pos - s0.pos;
+    dense.vel[1] = s1.vel - s0.vel;
+    dense.pos[2] = k1.dpos * h - dense.pos[1];
+    dense.vel[2] = k1.dvel * h - dense.vel[1];
+    dense.pos[3] = dense.pos[1] - k7.dpos * h - dense.pos[2];
+    dense.vel[3] = dense.vel[1] - k7.dvel * h - dense.vel[2];
+    dense.pos[4] = (k1.dpos * D1 + k3.dpos * D3 + k4.dpos * D4 + k5.dpos * D5 + k6.dpos * D6 + k7.dpos * D7) * h;
+    dense.vel[4] = (k1.dvel * D1 + k3.dvel * D3 + k4.dvel * D4 + k5.dvel * D5 + k6.dvel * D6 + k7.dvel * D7) * h;
     
-    // Check landing condition
-    if (current_state_.pos.z <= 0.0 && current_state_.t_sec > 0.01) {
-      current_state_.pos.z = 0.0;
-      current_state_.vel = Vec3(0.0, 0.0, 0.0);
-      current_state_.in_flight = false;
-      trajectory_.addPoint(current_state_);
+    adaptive_h_ = std::min(static_cast<Scalar>(config_.rk45_max_step_sec), h * factor);
+    fsal_ = k7;
+    last_dense_ = dense;
+    dense_valid_ = true;
+    
+    // Touchdown inside this step: locate it on the dense output
+    Scalar t_end = s1.t_sec;
+    bool landed = s1.pos.z <= Scalar(0) && s1.t_sec > Scalar(0.01);
+    State touchdown = s1;
+    if (landed && s0.pos.z > Scalar(0)) {
+      auto at = [&dense](Scalar t) { return dense.at(t); };
+      t_end = findTouchdownTime(s0.t_sec, s1.t_sec, at);
+      touchdown = dense.at(t_end);
+    }
+    
+    // Trajectory samples on the regular output grid
+    for (;;) {
+      Scalar t_out = static_cast<Scalar>(output_index_) * dt_fixed_;
+      if (t_out > t_end || (landed && t_out >= t_end)) {
+        break;
+      }
+      record(dense.at(t_out));
+      ++output_index_;
+    }
+    
+    if (landed) {
+      touchdown.pos.z = Scalar(0);
+      land(touchdown);
+      return true;
+    }
+    
+    current_state_ = s1;
+    return false;
+  }
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+auto BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::DenseStep::at(Scalar t) const -> State {
+  Scalar theta = h > Scalar(0) ? (t - t0) / h : Scalar(0);
+  Scalar theta1 = Scalar(1) - theta;
+  State s;
+  s.t_sec = t;
+  s.pos = pos[0] + (pos[1] + (pos[2] + (pos[3] + pos[4] * theta1) * theta) * theta1) * theta;
+  s.vel = vel[0] + (vel[1] + (vel[2] + (vel[3] + vel[4] * theta1) * theta) * theta1) * theta;
+  s.spin = spin0 + (spin1 - spin0) * theta;
+  s.in_flight = true;
+  return s;
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+void BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::precomputeFlight() {
+  // Same integration as the real-time path, so results are identical
+  while (current_state_.t_sec < config_.max_flight_time_sec) {
+    if (advanceStep()) {
       break;
     }
   }
+  
+  if (current_state_.in_flight) {
+    // Safety cap reached: terminate the flight where it is
+    land(current_state_);
+  }
+  
+  while (phase_ == Phase::Ground) {
+    advanceGroundStep();
+  }
+  
+  // Rewind the visible ball to the launch point for playback
+  current_state_ = State(trajectory_.getPoint(0));
+  phase_ = Phase::Flight;
 }
 
-void PhysicsEngine::integrate(double dt) {
-  if (!current_state_.in_flight) {
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+void BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::land(const State& touchdown) {
+  // Keep the exact touchdown state (including impact velocity) for results
+  landing_state_ = touchdown;
+  landing_state_.in_flight = false;
+  result_available_ = true;
+  record(landing_state_, true);
+  
+  current_state_ = landing_state_;
+  if (config_.ground_phase) {
+    // Bounce off the touchdown point, then roll
+    phase_ = Phase::Ground;
+    bounce(current_state_);
     return;
   }
   
-  // Simple Euler integration (can be upgraded to RK4 if needed)
-  Vec3 accel = computeAcceleration(current_state_);
+  // The ball stops where it lands
+  settle();
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+bool BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::advanceGroundStep() {
+  State& s = current_state_;
+  const Scalar g = gravity_;
+  Scalar remaining = static_cast<Scalar>(config_.ground_dt_sec);
+  
+  while (remaining > Scalar(0)) {
+    if (s.pos.z > Scalar(0) || s.vel.z > Scalar(0)) {
+      // Hop: gravity only, touchdown time solved exactly
+      Scalar t_hit = (s.vel.z + std::sqrt(s.vel.z * s.vel.z + Scalar(2) * g * s.pos.z)) / g;
+      Scalar t = std::min(t_hit, remaining);
+      s.pos = s.pos + s.vel * t;
+      s.pos.z -= Scalar(0.5) * g * t * t;
+      s.vel.z -= g * t;
+      s.t_sec += t;
+      remaining -= t;
+      if (t < t_hit) {
+        break;
+      }
+      s.pos.z = Scalar(0);
+      bounce(s);
+      record(s, true);
+      continue;
+    }
+    
+    // Roll: constant deceleration against the direction of motion
+    Scalar speed = s.vel.length();
+    Scalar decel = static_cast<Scalar>(config_.ground_rolling_resistance) * g;
+    Scalar t_stop = decel > Scalar(0) ? speed / decel : remaining + Scalar(1);
+    if (speed <= static_cast<Scalar>(config_.ground_rest_speed) || t_stop <= remaining) {
+      s.pos = s.pos + s.vel * (Scalar(0.5) * std::min(t_stop, remaining));
+      s.t_sec += std::min(t_stop, remaining);
+      settle();
+      return true;
+    }
+    Scalar slow = Scalar(1) - decel * remaining / speed;
+    s.pos = s.pos + s.vel * (remaining * Scalar(0.5) * (Scalar(1) + slow));
+    s.vel = s.vel * slow;
+    s.t_sec += remaining;
+    remaining = Scalar(0);
+  }
+  
+  if (s.t_sec - landing_state_.t_sec >= config_.max_ground_time_sec) {
+    settle();
+    return true;
+  }
+  record(s);
+  return false;
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+void BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::bounce(State& s) const {
+  const Scalar rpm_to_rad = static_cast<Scalar>(RPM_TO_RAD_PER_SEC);
+  const Scalar restitution = static_cast<Scalar>(config_.ground_restitution);
+  Scalar impact = std::max(Scalar(0), -s.vel.z);
+  Scalar r = ball_radius_;
+  Vec omega = s.spin * rpm_to_rad;
   
-  current_state_.vel = current_state_.vel + accel * dt;
-  current_state_.pos = current_state_.pos + current_state_.vel * dt;
-  current_state_.t_sec += dt;
+  // Slip of the contact point: v + omega x (0, 0, -r)
+  Vec slip(s.vel.x - r * omega.y, s.vel.y + r * omega.x, Scalar(0));
+  Scalar slip_mag = slip.length();
+  if (slip_mag > Scalar(1e-9)) {
+    // Coulomb friction impulse per unit mass, capped where slip stops
+    // (solid sphere: 1 + m r^2 / I = 3.5). Backspin checks the ball.
+    Scalar j = std::min(static_cast<Scalar>(config_.ground_friction) * (Scalar(1) + restitution) * impact,
+                        slip_mag / Scalar(3.5));
+    Vec dir = slip * (Scalar(1) / slip_mag);
+    s.vel.x -= j * dir.x;
+    s.vel.y -= j * dir.y;
+    Scalar dw = Scalar(2.5) * j / r / rpm_to_rad;
+    s.spin.x -= dw * dir.y;
+    s.spin.y += dw * dir.x;
+  }
   
-  // Store trajectory point (can be downsampled later if needed)
-  trajectory_.addPoint(current_state_);
+  // Normal rebound; weak ones turn into rolling
+  s.vel.z = restitution * impact;
+  if (s.vel.z < config_.ground_min_bounce_speed) {
+    s.vel.z = Scalar(0);
+  }
+  s.pos.z = Scalar(0);
 }
 
-Vec3 PhysicsEngine::computeAcceleration(const BallState& state) const {
-  Vec3 accel;
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+void BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::settle() {
+  current_state_.vel = Vec(0, 0, 0);
+  current_state_.pos.z = Scalar(0);
+  current_state_.in_flight = false;
+  rest_state_ = current_state_;
+  rest_available_ = true;
+  phase_ = Phase::Rest;
+  if (config_.ground_phase) {
+    record(rest_state_, true);
+  }
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+void BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::record(const State& state, bool keyframe) {
+  // The trajectory stores floats; narrow through the double state
+  if constexpr (std::is_same<Scalar, double>::value) {
+    trajectory_.addPoint(state, keyframe);
+  } else {
+    trajectory_.addPoint(BallState(state), keyframe);
+  }
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+void BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::advancePlayback(double dt_real) {
+  playback_t_ += dt_real;
   
+  if (playback_t_ >= rest_state_.t_sec) {
+    current_state_ = rest_state_;
+    phase_ = Phase::Rest;
+    return;
+  }
+  current_state_ = State(trajectory_.sampleAt(playback_t_));
+  if (playback_t_ >= landing_state_.t_sec) {
+    current_state_.in_flight = false;
+    phase_ = Phase::Ground;
+  }
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+void BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::integrate(Scalar dt) {
+  if (!current_state_.in_flight) {
+    return;
+  }
+  
+  if (integrator() == PhysicsConfig::Integrator::RK4) {
+    integrateRK4(dt);
+  } else {
+    // Simple Euler integration (semi-implicit: position uses the new velocity)
+    Derivative d = evaluate(current_state_);
+    
+    current_state_.vel = current_state_.vel + d.dvel * dt;
+    current_state_.pos = current_state_.pos + current_state_.vel * dt;
+    current_state_.spin = current_state_.spin + d.dspin * dt;
+    current_state_.t_sec += dt;
+  }
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+void BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::integrateRK4(Scalar dt) {
+  const State s = current_state_;
+  Derivative k1 = evaluate(s);
+  Derivative k2 = evaluate(shifted(s, k1, Scalar(0.5) * dt));
+  Derivative k3 = evaluate(shifted(s, k2, Scalar(0.5) * dt));
+  Derivative k4 = evaluate(shifted(s, k3, dt));
+  
+  current_state_.pos = s.pos + (k1.dpos + (k2.dpos + k3.dpos) * Scalar(2) + k4.dpos) * (dt / Scalar(6));
+  current_state_.vel = s.vel + (k1.dvel + (k2.dvel + k3.dvel) * Scalar(2) + k4.dvel) * (dt / Scalar(6));
+  current_state_.spin = s.spin + (k1.dspin + (k2.dspin + k3.dspin) * Scalar(2) + k4.dspin) * (dt / Scalar(6));
+  current_state_.t_sec = s.t_sec + dt;
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+auto BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::evaluate(const State& state) -> Derivative {
+  ++force_evaluations_;
+  return Derivative{state.vel, computeAcceleration(state), computeSpinRate(state)};
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+auto BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::shifted(
+    const State& state, const Derivative& d, Scalar dt) -> State {
+  State s = state;
+  s.t_sec = state.t_sec + dt;
+  s.pos = state.pos + d.dpos * dt;
+  s.vel = state.vel + d.dvel * dt;
+  s.spin = state.spin + d.dspin * dt;
+  return s;
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+auto BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::computeAcceleration(
+    const State& state) const -> Vec {
   // Gravity
-  accel.z = -config_.gravity;
+  Vec accel(0, 0, -gravity_);
   
-  // Air resistance (simplified drag model)
-  Vec3 v_rel = state.vel - config_.wind_velocity;
-  double v_rel_mag = v_rel.length();
+  Vec v_rel = state.vel - wind_;
+  if (wind_field_) {
+    // Trilinear grid lookup: O(1), no noise evaluated here
+    v_rel = v_rel - Vec(wind_field_->sample(Vec3(state.pos), wind_time_offset_ + state.t_sec));
+  }
+  Scalar v_rel_mag = v_rel.length();
+  
+  if (v_rel_mag <= Scalar(1e-6)) {
+    return accel;
+  }
   
-  if (v_rel_mag > 1e-6) {
+  const bool tabulated = tabulatedDrag();
+  const bool magnus = magnusLift();
+  if (!tabulated && !magnus) {
+    // Air resistance (simplified drag model)
     // Drag force: F_d = -k * |v|^2 * v_hat
     // a_d = F_d / m = -k * |v| * v (assuming unit mass)
-    Vec3 drag = v_rel.normalized() * (-config_.drag_coefficient * v_rel_mag * v_rel_mag);
-    accel = accel + drag;
+    Vec drag = v_rel.normalized() * (-drag_coefficient_ * v_rel_mag * v_rel_mag);
+    return accel + drag;
+  }
+  
+  // Cd and Cl from the table at this Re and spin ratio
+  Scalar spin_mag = state.spin.length();
+  Scalar omega = spin_mag * static_cast<Scalar>(RPM_TO_RAD_PER_SEC);
+  AeroCoefficients c = lookupAeroCoefficients(v_rel_mag * reynolds_per_speed_,
+                                              ball_radius_ * omega / v_rel_mag);
+  
+  if (tabulated) {
+    // a_d = -(rho A / 2m) * Cd * |v| * v
+    accel = accel + v_rel * (-aero_k_ * static_cast<Scalar>(c.drag) * v_rel_mag);
+  } else {
+    accel = accel + v_rel.normalized() * (-drag_coefficient_ * v_rel_mag * v_rel_mag);
   }
   
-  // TODO: Add Magnus force for spin effects if needed in future
+  // Magnus: a_l = (rho A / 2m) * Cl * |v| * (omega_hat x v)
+  if (magnus && spin_mag > Scalar(1e-9)) {
+    Vec axis = state.spin * (Scalar(1) / spin_mag);
+    accel = accel + axis.cross(v_rel) * (aero_k_ * static_cast<Scalar>(c.lift) * v_rel_mag);
+  }
   
   return accel;
 }
 
-bool PhysicsEngine::hasLanded() const {
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+auto BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::computeSpinRate(
+    const State& state) const -> Vec {
+  if (!magnusLift()) {
+    return Vec();
+  }
+  // Exponential decay from air friction on the spinning ball
+  return state.spin * -spin_decay_rate_;
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+bool BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::hasLanded() const {
   return !current_state_.in_flight;
 }
 
-ShotResult PhysicsEngine::calculateResult() const {
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+bool BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::isResultAvailable() const {
+  return result_available_;
+}
+
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+ShotResult BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::calculateResult() const {
   ShotResult result;
   
   if (trajectory_.empty()) {
     return result;
   }
   
-  const BallState& final_state = trajectory_.getLastPoint();
+  // Exact landing state when known (trajectory samples are stored as floats)
+  const BallState final_state(result_available_ ? landing_state_ : current_state_);
+  const Vec3 initial_position(initial_position_);
   
   // Carry distance (straight-line distance from start to landing)
-  Vec3 displacement = final_state.pos - initial_position_;
+  Vec3 displacement = final_state.pos - initial_position;
   // Use Vec3 length calculation for horizontal distance (x-y plane)
   result.carry_m = Vec3(displacement.x, displacement.y, 0.0).length();
   
-  // Total distance (same as carry for now, can add roll later)
-  result.total_m = result.carry_m;
+  // Total distance to where the ball stops (still rolling: where it is now)
+  const BallState end_state(rest_available_ ? rest_state_ : current_state_);
+  Vec3 to_rest = end_state.pos - initial_position;
+  result.total_m = Vec3(to_rest.x, to_rest.y, 0.0).length();
+  result.rest_position = end_state.pos;
+  if (result_available_) {
+    Vec3 roll = end_state.pos - final_state.pos;
+    result.roll_m = Vec3(roll.x, roll.y, 0.0).length();
+  }
   
   // Lateral distance (x-axis deviation)
   result.lateral_m = final_state.pos.x;
@@ -116,18 +710,42 @@ ShotResult PhysicsEngine::calculateResult() const {
   // Flight time
   result.flight_time_s = final_state.t_sec;
   
-  // Landing position
+  // Landing position and impact velocity
   result.landing_position = final_state.pos;
+  result.landing_velocity = final_state.vel;
   
   return result;
 }
 
-void PhysicsEngine::reset() {
-  current_state_ = BallState();
+template <typename Scalar, typename Integrator, typename DragModel, typename SpinModel>
+void BasicPhysicsEngine<Scalar, Integrator, DragModel, SpinModel>::reset() {
+  current_state_ = State();
   current_state_.in_flight = false;
+  previous_state_ = current_state_;
   trajectory_.clear();
   accumulator_ = 0.0;
-  initial_position_ = Vec3(0.0, 0.0, 0.0);
+  last_step_sec_ = 0.0;
+  playback_t_ = 0.0;
+  result_available_ = false;
+  rest_available_ = false;
+  dense_valid_ = false;
+  phase_ = Phase::Rest;
+  initial_position_ = Vec(0, 0, 0);
+}
+
+PhysicsConfig headlessLandingConfig(PhysicsConfig config) {
+  config.integrator = PhysicsConfig::Integrator::RK45;
+  config.precompute_flight = false;
+  config.ground_phase = false;
+  config.max_trajectory_points = Trajectory::MIN_CAPACITY;
+  return config;
 }
 
+template class BasicPhysicsEngine<double, ConfiguredIntegrator, ConfiguredDrag, ConfiguredSpin>;
+template class BasicPhysicsEngine<double, RK4Integrator, TabulatedDrag, MagnusSpin>;
+template class BasicPhysicsEngine<float, RK4Integrator, TabulatedDrag, MagnusSpin>;
+template class BasicPhysicsEngine<double, RK45Integrator, TabulatedDrag, MagnusSpin>;
+template class BasicPhysicsEngine<double, EulerIntegrator, QuadraticDrag, NoSpin>;
+template class BasicPhysicsEngine<float, EulerIntegrator, QuadraticDrag, NoSpin>;
+
 } // namespace domain
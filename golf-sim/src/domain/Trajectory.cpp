@@ -1,21 +1,158 @@
 #include "domain/Trajectory.hpp"
+#include <algorithm>
 #include <stdexcept>
 
 namespace domain {
 
-void Trajectory::addPoint(const BallState& state) {
-  points_.push_back(state);
+Trajectory::Trajectory(size_t capacity)
+  : capacity_(std::max(capacity, MIN_CAPACITY))
+  , t_(capacity_)
+  , x_(capacity_), y_(capacity_), z_(capacity_)
+  , vx_(capacity_), vy_(capacity_), vz_(capacity_)
+  , flags_(capacity_) {
+}
+
+void Trajectory::addPoint(const BallState& state, bool keyframe) {
+  // A provisional tail is replaced by the newer point unless it stays the
+  // apex (the newer point is not higher)
+  if (size_ > 0 && (flags_[size_ - 1] & PROVISIONAL)) {
+    if (apex_index_ == size_ - 1 && static_cast<float>(state.pos.z) <= z_[size_ - 1]) {
+      flags_[size_ - 1] &= ~PROVISIONAL;
+    } else {
+      --size_;
+    }
+  }
+  
+  uint8_t flags = state.in_flight ? IN_FLIGHT : 0;
+  if (keyframe) {
+    flags |= KEYFRAME;
+  } else if (offered_ % stride_ != 0) {
+    flags |= PROVISIONAL;
+  }
+  ++offered_;
+  
+  if (size_ == capacity_) {
+    decimate();
+  }
+  store(state, flags);
+}
+
+void Trajectory::store(const BallState& state, uint8_t flags) {
+  size_t i = size_++;
+  t_[i] = static_cast<float>(state.t_sec);
+  x_[i] = static_cast<float>(state.pos.x);
+  y_[i] = static_cast<float>(state.pos.y);
+  z_[i] = static_cast<float>(state.pos.z);
+  vx_[i] = static_cast<float>(state.vel.x);
+  vy_[i] = static_cast<float>(state.vel.y);
+  vz_[i] = static_cast<float>(state.vel.z);
+  flags_[i] = flags;
+  
+  if (i == 0 || z_[i] > z_[apex_index_]) {
+    apex_index_ = i;
+  }
+}
+
+void Trajectory::decimate() {
+  // Keep every other point plus first, last, apex and keyframes
+  size_t out = 0;
+  for (size_t i = 0; i < size_; ++i) {
+    bool keep = (i % 2 == 0) || i == size_ - 1 || i == apex_index_ || (flags_[i] & KEYFRAME);
+    if (!keep) {
+      continue;
+    }
+    if (i == apex_index_) {
+      apex_index_ = out;
+    }
+    t_[out] = t_[i];
+    x_[out] = x_[i];
+    y_[out] = y_[i];
+    z_[out] = z_[i];
+    vx_[out] = vx_[i];
+    vy_[out] = vy_[i];
+    vz_[out] = vz_[i];
+    flags_[out] = flags_[i];
+    ++out;
+  }
+  
+  if (out == size_) {
+    // Nothing removable (all keyframes): give up the oldest non-first slot
+    std::copy(t_.begin() + 2, t_.begin() + size_, t_.begin() + 1);
+    std::copy(x_.begin() + 2, x_.begin() + size_, x_.begin() + 1);
+    std::copy(y_.begin() + 2, y_.begin() + size_, y_.begin() + 1);
+    std::copy(z_.begin() + 2, z_.begin() + size_, z_.begin() + 1);
+    std::copy(vx_.begin() + 2, vx_.begin() + size_, vx_.begin() + 1);
+    std::copy(vy_.begin() + 2, vy_.begin() + size_, vy_.begin() + 1);
+    std::copy(vz_.begin() + 2, vz_.begin() + size_, vz_.begin() + 1);
+    std::copy(flags_.begin() + 2, flags_.begin() + size_, flags_.begin() + 1);
+    out = size_ - 1;
+    if (apex_index_ > 1) {
+      --apex_index_;
+    }
+  }
+  
+  size_ = out;
+  stride_ *= 2;
 }
 
 void Trajectory::clear() {
-  points_.clear();
+  // Storage is kept for the next shot
+  size_ = 0;
+  stride_ = 1;
+  offered_ = 0;
+  apex_index_ = 0;
 }
 
-const BallState& Trajectory::getLastPoint() const {
-  if (points_.empty()) {
+BallState Trajectory::getPoint(size_t index) const {
+  if (index >= size_) {
+    throw std::out_of_range("Trajectory index out of range");
+  }
+  BallState state;
+  state.t_sec = t_[index];
+  state.pos = Vec3(x_[index], y_[index], z_[index]);
+  state.vel = Vec3(vx_[index], vy_[index], vz_[index]);
+  state.in_flight = (flags_[index] & IN_FLIGHT) != 0;
+  return state;
+}
+
+BallState Trajectory::getLastPoint() const {
+  if (size_ == 0) {
     throw std::runtime_error("Trajectory is empty");
   }
-  return points_.back();
+  return getPoint(size_ - 1);
+}
+
+BallState Trajectory::sampleAt(double t_sec) const {
+  if (size_ == 0) {
+    throw std::runtime_error("Trajectory is empty");
+  }
+  if (t_sec <= t_[0]) {
+    return getPoint(0);
+  }
+  if (t_sec >= t_[size_ - 1]) {
+    return getPoint(size_ - 1);
+  }
+  
+  // First point strictly after t (points are recorded in time order)
+  size_t next = static_cast<size_t>(
+    std::upper_bound(t_.begin(), t_.begin() + size_, static_cast<float>(t_sec)) - t_.begin());
+  if (next == 0) {
+    return getPoint(0);
+  }
+  if (next >= size_) {
+    return getPoint(size_ - 1);
+  }
+  BallState a = getPoint(next - 1);
+  BallState b = getPoint(next);
+  
+  double span = b.t_sec - a.t_sec;
+  double alpha = span > 0.0 ? (t_sec - a.t_sec) / span : 0.0;
+  
+  BallState out = a;
+  out.t_sec = t_sec;
+  out.pos = a.pos + (b.pos - a.pos) * alpha;
+  out.vel = a.vel + (b.vel - a.vel) * alpha;
+  return out;
 }
 
 } // namespace domain
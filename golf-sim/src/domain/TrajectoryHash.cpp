@@ -0,0 +1,60 @@
+#include "domain/TrajectoryHash.hpp"
+#include "domain/Fnv1a.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace domain {
+
+namespace {
+
+// Samples are stored as floats: hash exactly those bits, with -0 folded
+// into +0 so the sign of a zero does not matter
+void addSample(Fnv1a& h, double value, double quantum) {
+  if (quantum > 0.0) {
+    h.add(static_cast<int64_t>(std::llround(value / quantum)));
+    return;
+  }
+  float f = static_cast<float>(value);
+  if (f == 0.0f) {
+    f = 0.0f;
+  }
+  uint32_t bits;
+  std::memcpy(&bits, &f, sizeof(bits));
+  h.add(bits);
+}
+
+} // namespace
+
+uint64_t hashTrajectory(const Trajectory& trajectory, double quantum) {
+  Fnv1a h;
+  h.add(static_cast<uint64_t>(trajectory.size()));
+  for (size_t i = 0; i < trajectory.size(); ++i) {
+    BallState s = trajectory.getPoint(i);
+    addSample(h, s.t_sec, quantum);
+    addSample(h, s.pos.x, quantum);
+    addSample(h, s.pos.y, quantum);
+    addSample(h, s.pos.z, quantum);
+    addSample(h, s.vel.x, quantum);
+    addSample(h, s.vel.y, quantum);
+    addSample(h, s.vel.z, quantum);
+    h.add(static_cast<uint8_t>(s.in_flight ? 1 : 0));
+  }
+  return h.value();
+}
+
+TrajectoryDifference compareTrajectories(const Trajectory& a, const Trajectory& b) {
+  TrajectoryDifference diff;
+  diff.same_length = a.size() == b.size();
+  diff.compared = std::min(a.size(), b.size());
+  for (size_t i = 0; i < diff.compared; ++i) {
+    BallState sa = a.getPoint(i);
+    BallState sb = b.getPoint(i);
+    diff.max_time_s = std::max(diff.max_time_s, std::abs(sa.t_sec - sb.t_sec));
+    diff.max_position_m = std::max(diff.max_position_m, (sa.pos - sb.pos).length());
+    diff.max_velocity_mps = std::max(diff.max_velocity_mps, (sa.vel - sb.vel).length());
+  }
+  return diff;
+}
+
+} // namespace domain
@@ -0,0 +1,163 @@
+#include "domain/WindField.hpp"
+#include "domain/ConstexprMath.hpp"
+#include "domain/SplitMix64.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace domain {
+
+namespace {
+
+// Periodic noise knots with unit variance (uniform in [-sqrt3, sqrt3])
+std::vector<double> makeKnots(size_t count, uint64_t& state) {
+  std::vector<double> knots(count);
+  for (double& k : knots) {
+    double u = static_cast<double>(splitMix64(state) >> 11) * (1.0 / 9007199254740992.0);
+    k = (2.0 * u - 1.0) * std::sqrt(3.0);
+  }
+  return knots;
+}
+
+// Catmull-Rom through periodic knots; u in knot units
+double periodicSpline(const std::vector<double>& knots, double u) {
+  const long n = static_cast<long>(knots.size());
+  double base = std::floor(u);
+  double f = u - base;
+  long i = static_cast<long>(base) % n;
+  if (i < 0) i += n;
+  double p0 = knots[(i + n - 1) % n];
+  double p1 = knots[i];
+  double p2 = knots[(i + 1) % n];
+  double p3 = knots[(i + 2) % n];
+  return p1 + 0.5 * f * (p2 - p0 + f * (2.0 * p0 - 5.0 * p1 + 4.0 * p2 - p3
+                                        + f * (3.0 * (p1 - p2) + p3 - p0)));
+}
+
+// Two octaves of noise, renormalised to unit variance
+struct GustSeries {
+  std::vector<double> coarse;
+  std::vector<double> fine;
+  double knot_sec = 1.0;
+  
+  double at(double t_sec) const {
+    double u = t_sec / knot_sec;
+    return (periodicSpline(coarse, u) + 0.5 * periodicSpline(fine, 2.0 * u)) / std::sqrt(1.25);
+  }
+};
+
+size_t gridPoints(double extent, double step) {
+  if (!(step > 0.0) || !(extent > 0.0)) {
+    return 2;
+  }
+  return std::max<size_t>(2, static_cast<size_t>(std::floor(extent / step + 1e-9)) + 1);
+}
+
+// Continuous grid coordinate clamped to [0, n - 1]; returns the cell index
+size_t locate(double coord, size_t n, double& frac) {
+  double limit = static_cast<double>(n - 1);
+  coord = std::min(std::max(coord, 0.0), limit);
+  size_t i = std::min(static_cast<size_t>(coord), n - 2);
+  frac = coord - static_cast<double>(i);
+  return i;
+}
+
+} // namespace
+
+WindField::WindField(const WindFieldConfig& config)
+  : config_(config) {
+  double rad = config_.direction_deg * PI / 180.0;
+  along_ = Vec3(std::cos(rad), std::sin(rad), 0.0);
+  across_ = Vec3(-along_.y, along_.x, 0.0);
+  
+  double z0 = config_.roughness_length_m > 0.0 ? config_.roughness_length_m : 0.03;
+  double z_ref = config_.reference_height_m > 0.0 ? config_.reference_height_m : 10.0;
+  config_.roughness_length_m = z0;
+  config_.reference_height_m = z_ref;
+  profile_norm_ = 1.0 / std::log1p(z_ref / z0);
+  
+  nz_ = gridPoints(config_.max_height_m, config_.height_step_m);
+  ny_ = gridPoints(config_.max_downrange_m - config_.min_downrange_m, config_.downrange_step_m);
+  dz_ = config_.max_height_m > 0.0 ? config_.max_height_m / static_cast<double>(nz_ - 1) : 1.0;
+  dy_ = config_.max_downrange_m > config_.min_downrange_m
+    ? (config_.max_downrange_m - config_.min_downrange_m) / static_cast<double>(ny_ - 1) : 1.0;
+  
+  // Periodic time axis: nt_ nodes over [0, duration)
+  double duration = config_.duration_sec > 0.0 ? config_.duration_sec : 32.0;
+  double time_step = config_.time_step_sec > 0.0 ? config_.time_step_sec : 0.5;
+  nt_ = std::max<size_t>(2, static_cast<size_t>(std::lround(duration / time_step)));
+  dt_ = duration / static_cast<double>(nt_);
+  config_.duration_sec = duration;
+  
+  // Knot spacing rounded so the noise is periodic over the duration
+  size_t knots = std::max<size_t>(3, static_cast<size_t>(
+    std::lround(duration / std::max(config_.gust_period_sec, 1e-3))));
+  uint64_t state = config_.seed;
+  GustSeries along_gust{makeKnots(knots, state), makeKnots(2 * knots, state), duration / knots};
+  GustSeries across_gust{makeKnots(knots, state), makeKnots(2 * knots, state), duration / knots};
+  
+  // Gusts travel downwind: a station further along the wind sees the
+  // same series later
+  double speed = config_.speed_mps;
+  double travel_speed = std::max(std::abs(speed), 1.0);
+  double along_amp = config_.gust_intensity;
+  double across_amp = config_.gust_intensity * config_.gust_lateral_ratio;
+  
+  nodes_.assign(nz_ * ny_ * nt_ * 2, 0.0f);
+  for (size_t it = 0; it < nt_; ++it) {
+    double t = static_cast<double>(it) * dt_;
+    for (size_t iy = 0; iy < ny_; ++iy) {
+      double y = config_.min_downrange_m + static_cast<double>(iy) * dy_;
+      double delayed = t - y * along_.y / travel_speed;
+      Vec3 wind = (along_ * (1.0 + along_amp * along_gust.at(delayed))
+                   + across_ * (across_amp * across_gust.at(delayed))) * speed;
+      for (size_t iz = 0; iz < nz_; ++iz) {
+        double factor = profileFactor(static_cast<double>(iz) * dz_);
+        size_t n = nodeIndex(iz, iy, it);
+        nodes_[n] = static_cast<float>(wind.x * factor);
+        nodes_[n + 1] = static_cast<float>(wind.y * factor);
+      }
+    }
+  }
+}
+
+double WindField::profileFactor(double z) const {
+  if (!(z > 0.0)) {
+    return 0.0;
+  }
+  return std::log1p(z / config_.roughness_length_m) * profile_norm_;
+}
+
+Vec3 WindField::meanWind(double z) const {
+  return along_ * (config_.speed_mps * profileFactor(z));
+}
+
+Vec3 WindField::sample(const Vec3& pos, double t_sec) const {
+  double fz, fy;
+  size_t iz = locate(pos.z / dz_, nz_, fz);
+  size_t iy = locate((pos.y - config_.min_downrange_m) / dy_, ny_, fy);
+  
+  // Time wraps around the periodic axis
+  double ct = t_sec / dt_;
+  ct -= std::floor(ct / static_cast<double>(nt_)) * static_cast<double>(nt_);
+  size_t it0 = std::min(static_cast<size_t>(ct), nt_ - 1);
+  double ft = ct - static_cast<double>(it0);
+  size_t it1 = it0 + 1 == nt_ ? 0 : it0 + 1;
+  
+  // Eight corners as (x, y) pairs: z neighbour is adjacent, then y, then t
+  const float* p0 = &nodes_[nodeIndex(iz, iy, it0)];
+  const float* p1 = &nodes_[nodeIndex(iz, iy, it1)];
+  const size_t row = nz_ * 2;
+  double out[2];
+  for (int c = 0; c < 2; ++c) {
+    double c00 = p0[c] + (p0[c + 2] - p0[c]) * fz;
+    double c10 = p0[row + c] + (p0[row + c + 2] - p0[row + c]) * fz;
+    double c01 = p1[c] + (p1[c + 2] - p1[c]) * fz;
+    double c11 = p1[row + c] + (p1[row + c + 2] - p1[row + c]) * fz;
+    double c0 = c00 + (c10 - c00) * fy;
+    double c1 = c01 + (c11 - c01) * fy;
+    out[c] = c0 + (c1 - c0) * ft;
+  }
+  return Vec3(out[0], out[1], 0.0);
+}
+
+} // namespace domain
@@ -0,0 +1,16 @@
+#include "infrastructure/EventQueue.hpp"
+
+namespace infrastructure {
+
+EventQueue::EventQueue(size_t capacity, OverflowPolicy policy)
+  : capacity_(1)
+  , mask_(0)
+  , policy_(policy) {
+  while (capacity_ < capacity) {
+    capacity_ <<= 1;
+  }
+  mask_ = capacity_ - 1;
+  slots_ = std::make_unique<Slot[]>(static_cast<size_t>(capacity_));
+}
+
+} // namespace infrastructure
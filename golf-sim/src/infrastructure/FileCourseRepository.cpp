@@ -29,6 +29,13 @@ application::CourseInfo FileCourseRepository::loadHole(int hole_number) const {
       if (hole == hole_number) {
         if (par > 0) info.par = par;
         if (dist > 0.0) info.pin_distance_m = dist;
+        // Optional wind columns
+        double wind_speed = 0.0;
+        double wind_direction = 0.0;
+        if (ss >> comma >> wind_speed >> comma >> wind_direction) {
+          if (wind_speed >= 0.0) info.wind_speed_mps = wind_speed;
+          info.wind_direction_deg = wind_direction;
+        }
         break;
       }
     }
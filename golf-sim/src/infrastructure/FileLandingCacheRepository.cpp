@@ -0,0 +1,105 @@
+#include "infrastructure/FileLandingCacheRepository.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace infrastructure {
+
+namespace {
+
+constexpr char MAGIC[8] = {'G', 'S', 'L', 'A', 'N', 'D', 'T', 'B'};
+constexpr uint32_t VERSION = 1;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t float_size;  // Guards against foreign float layouts
+  uint64_t key;
+  uint64_t count;
+};
+
+class MappedFloats : public application::CachedFloats {
+public:
+  MappedFloats(void* base, size_t length, size_t count)
+    : base_(base), length_(length), count_(count) {}
+  ~MappedFloats() override { munmap(base_, length_); }
+  
+  const float* data() const override {
+    return reinterpret_cast<const float*>(static_cast<const char*>(base_) + sizeof(Header));
+  }
+  size_t size() const override { return count_; }
+  
+private:
+  void* base_;
+  size_t length_;
+  size_t count_;
+};
+
+} // namespace
+
+FileLandingCacheRepository::FileLandingCacheRepository(std::string path)
+  : path_(std::move(path)) {}
+
+std::unique_ptr<application::CachedFloats> FileLandingCacheRepository::load(uint64_t key) const {
+  int fd = open(path_.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Header))) {
+    close(fd);
+    return nullptr;
+  }
+  size_t length = static_cast<size_t>(st.st_size);
+  void* base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // The mapping keeps the file referenced
+  if (base == MAP_FAILED) {
+    return nullptr;
+  }
+  
+  Header header;
+  std::memcpy(&header, base, sizeof(Header));
+  bool valid = std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0
+    && header.version == VERSION
+    && header.float_size == sizeof(float)
+    && header.key == key
+    && header.count == (length - sizeof(Header)) / sizeof(float);
+  if (!valid) {
+    munmap(base, length);
+    return nullptr;
+  }
+  return std::unique_ptr<application::CachedFloats>(
+    new MappedFloats(base, length, static_cast<size_t>(header.count)));
+}
+
+bool FileLandingCacheRepository::save(uint64_t key, const float* data, size_t count) {
+  // Write to a temporary file and rename, so readers never see a partial table
+  std::string tmp_path = path_ + ".tmp";
+  FILE* file = std::fopen(tmp_path.c_str(), "wb");
+  if (!file) {
+    return false;
+  }
+  
+  Header header;
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.float_size = sizeof(float);
+  header.key = key;
+  header.count = count;
+  
+  bool ok = std::fwrite(&header, sizeof(Header), 1, file) == 1
+    && std::fwrite(data, sizeof(float), count, file) == count;
+  ok = std::fclose(file) == 0 && ok;
+  if (!ok || std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+} // namespace infrastructure
@@ -0,0 +1,154 @@
+#include "infrastructure/InputThread.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <time.h>
+
+namespace infrastructure {
+
+namespace {
+
+constexpr int64_t NS_PER_SEC = 1000000000;
+
+int64_t monotonicNowNs() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * NS_PER_SEC + ts.tv_nsec;
+}
+
+void sleepUntilNs(int64_t deadline_ns) {
+  timespec ts;
+  ts.tv_sec = static_cast<time_t>(deadline_ns / NS_PER_SEC);
+  ts.tv_nsec = static_cast<long>(deadline_ns % NS_PER_SEC);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+  }
+}
+
+} // namespace
+
+InputThread::InputThread(ISensorProvider& provider, EventQueue& queue,
+                         const InputThreadConfig& config)
+  : provider_(provider)
+  , queue_(queue)
+  , config_(config) {
+  if (!(config_.poll_rate_hz > 0.0)) {
+    config_.poll_rate_hz = 2000.0;
+  }
+}
+
+InputThread::~InputThread() {
+  stop();
+}
+
+void InputThread::start() {
+  if (running_.exchange(true)) {
+    return;
+  }
+  start_ns_.store(monotonicNowNs());
+  stop_ns_.store(0);
+  thread_ = std::thread([this] { run(); });
+}
+
+void InputThread::stop() {
+  running_.store(false);
+  if (thread_.joinable()) {
+    thread_.join();
+    stop_ns_.store(monotonicNowNs());
+  }
+}
+
+size_t InputThread::pollOnce() {
+  size_t count = 0;
+  for (;;) {
+    size_t n = provider_.pollBatch(batch_, BATCH_FRAMES);
+    if (config_.restamp_frames && n > 0) {
+      // No frame of the batch can be later than its arrival
+      double now = monotonicNowSec();
+      double newest = batch_[n - 1].t_sec;
+      if (!stamp_anchored_) {
+        stamp_offset_sec_ = now - newest;
+        stamp_anchored_ = true;
+      } else if (batch_[0].t_sec <= last_provider_sec_ || newest + stamp_offset_sec_ > now) {
+        // Re-anchor, but never stamp earlier than the previous frame
+        stamp_offset_sec_ = std::max(now - newest, last_stamp_sec_ - batch_[0].t_sec);
+      }
+      last_provider_sec_ = newest;
+      last_stamp_sec_ = newest + stamp_offset_sec_;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      SensorFrame& frame = batch_[i];
+      if (config_.restamp_frames) {
+        frame.t_sec += stamp_offset_sec_;
+      }
+      Event event;
+      event.type = Event::Type::Pose;
+      event.t_sec = frame.t_sec;
+      event.frame = frame;
+      queue_.push(event);
+    }
+    count += n;
+    if (n < BATCH_FRAMES) {
+      break;  // Drained
+    }
+  }
+  frames_.fetch_add(count, std::memory_order_relaxed);
+  return count;
+}
+
+InputThreadStats InputThread::stats() const {
+  InputThreadStats s;
+  s.wakeups = wakeups_.load(std::memory_order_relaxed);
+  s.frames = frames_.load(std::memory_order_relaxed);
+  s.overruns = overruns_.load(std::memory_order_relaxed);
+  s.missed_periods = missed_periods_.load(std::memory_order_relaxed);
+  
+  int64_t start = start_ns_.load(std::memory_order_relaxed);
+  int64_t end = stop_ns_.load(std::memory_order_relaxed);
+  if (start != 0) {
+    s.elapsed_sec = static_cast<double>((end != 0 ? end : monotonicNowNs()) - start) / NS_PER_SEC;
+  }
+  if (s.elapsed_sec > 0.0) {
+    s.poll_rate_hz = static_cast<double>(s.wakeups) / s.elapsed_sec;
+    s.frame_rate_hz = static_cast<double>(s.frames) / s.elapsed_sec;
+  }
+  if (s.wakeups > 0) {
+    s.mean_jitter_us = static_cast<double>(jitter_sum_ns_.load(std::memory_order_relaxed))
+                     / static_cast<double>(s.wakeups) / 1000.0;
+  }
+  s.max_jitter_us = static_cast<double>(jitter_max_ns_.load(std::memory_order_relaxed)) / 1000.0;
+  return s;
+}
+
+double InputThread::monotonicNowSec() {
+  return static_cast<double>(monotonicNowNs()) / NS_PER_SEC;
+}
+
+void InputThread::run() {
+  const int64_t period_ns = std::max<int64_t>(1, std::llround(NS_PER_SEC / config_.poll_rate_hz));
+  
+  int64_t deadline = monotonicNowNs() + period_ns;
+  while (running_.load(std::memory_order_relaxed)) {
+    sleepUntilNs(deadline);
+    
+    int64_t late = std::max<int64_t>(0, monotonicNowNs() - deadline);
+    jitter_sum_ns_.fetch_add(late, std::memory_order_relaxed);
+    if (late > jitter_max_ns_.load(std::memory_order_relaxed)) {
+      jitter_max_ns_.store(late, std::memory_order_relaxed);
+    }
+    
+    pollOnce();
+    wakeups_.fetch_add(1, std::memory_order_relaxed);
+    
+    // Past the next deadline already: skip the missed ones
+    deadline += period_ns;
+    int64_t now = monotonicNowNs();
+    if (now >= deadline) {
+      int64_t behind = (now - deadline) / period_ns + 1;
+      overruns_.fetch_add(1, std::memory_order_relaxed);
+      missed_periods_.fetch_add(static_cast<uint64_t>(behind), std::memory_order_relaxed);
+      deadline += behind * period_ns;
+    }
+  }
+}
+
+} // namespace infrastructure
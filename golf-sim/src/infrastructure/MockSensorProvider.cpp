@@ -3,6 +3,12 @@
 
 namespace infrastructure {
 
+namespace {
+
+constexpr double STREAM_DT_SEC = 0.001;  // Streamed frames at 1 kHz
+
+} // namespace
+
 MockSensorProvider::MockSensorProvider(Scenario scenario, unsigned int seed)
   : scenario_(scenario)
   , rng_(seed)
@@ -14,11 +20,28 @@ MockSensorProvider::MockSensorProvider(Scenario scenario, unsigned int seed)
 }
 
 bool MockSensorProvider::poll(SensorFrame& out) {
-  // Mock: only provide data when impact is triggered
-  if (!impact_triggered_) {
-    return false;
+  return pollBatch(&out, 1) == 1;
+}
+
+size_t MockSensorProvider::pollBatch(SensorFrame* out, size_t capacity) {
+  if (capacity == 0) {
+    return 0;
   }
   
+  size_t count = 0;
+  // Mock: the impact frame is one-shot and comes first
+  if (impact_triggered_.exchange(false, std::memory_order_acquire)) {
+    makeImpactFrame(out[count++]);
+  }
+  while (count < capacity && pending_stream_frames_ > 0) {
+    makeRestFrame(out[count++]);
+    --pending_stream_frames_;
+  }
+  poll_count_ += static_cast<int>(count);
+  return count;
+}
+
+void MockSensorProvider::makeImpactFrame(SensorFrame& out) {
   // Generate deterministic noise
   std::uniform_real_distribution<float> noise(-0.1f, 0.1f);
   
@@ -30,24 +53,45 @@ bool MockSensorProvider::poll(SensorFrame& out) {
   out.gx = noise(rng_);
   out.gy = noise(rng_);
   out.gz = 10.0f + noise(rng_);  // High rotation
-  
-  // One-shot: return true once then reset
-  impact_triggered_ = false;
-  poll_count_++;
-  
-  return true;
+  // Side spin shows up as yaw rate: slice clockwise (negative), hook positive
+  out.gz -= static_cast<float>(getSpinAxisDeg() * 0.2);
+}
+
+void MockSensorProvider::makeRestFrame(SensorFrame& out) {
+  std::uniform_real_distribution<float> noise(-0.02f, 0.02f);
+  current_time_ += STREAM_DT_SEC;
+  out.t_sec = current_time_;
+  out.ax = noise(rng_);
+  out.ay = noise(rng_);
+  out.az = 9.81f + noise(rng_);  // Gravity only
+  out.gx = noise(rng_);
+  out.gy = noise(rng_);
+  out.gz = noise(rng_);
+}
+
+void MockSensorProvider::streamFrames(uint64_t count) {
+  pending_stream_frames_ += count;
 }
 
 void MockSensorProvider::reset() {
   current_time_ = 0.0;
-  impact_triggered_ = false;
+  impact_triggered_.store(false);
   poll_count_ = 0;
+  pending_stream_frames_ = 0;
 }
 
 void MockSensorProvider::triggerImpact(double speed_mps, double angle_deg) {
-  impact_triggered_ = true;
   impact_speed_ = speed_mps;
   impact_angle_ = angle_deg;
+  impact_triggered_.store(true, std::memory_order_release);
+}
+
+double MockSensorProvider::getSpinAxisDeg() const {
+  switch (scenario_) {
+    case Scenario::Slice: return 15.0;
+    case Scenario::Hook:  return -15.0;
+    default:              return 0.0;
+  }
 }
 
 } // namespace infrastructure
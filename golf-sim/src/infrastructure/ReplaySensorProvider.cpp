@@ -0,0 +1,180 @@
+#include "infrastructure/ReplaySensorProvider.hpp"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace infrastructure {
+
+ReplaySensorProvider::ReplaySensorProvider(const std::string& path, Mode mode)
+  : mode_(mode) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    return;
+  }
+  size_t length = static_cast<size_t>(st.st_size);
+  void* base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // The mapping keeps the file referenced
+  if (base == MAP_FAILED) {
+    return;
+  }
+  if (mode_ == Mode::Fast) {
+    madvise(base, length, MADV_SEQUENTIAL);
+  }
+  data_ = static_cast<const char*>(base);
+  size_ = length;
+  
+  // Optional header line
+  size_t header = std::strlen(TRACE_CSV_HEADER);
+  if (size_ >= header && std::memcmp(data_, TRACE_CSV_HEADER, header) == 0) {
+    first_row_ = lineStartAtOrAfter(1);
+  }
+  cursor_ = first_row_;
+}
+
+ReplaySensorProvider::~ReplaySensorProvider() {
+  if (data_) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+}
+
+bool ReplaySensorProvider::poll(SensorFrame& out) {
+  return pollBatch(&out, 1) == 1;
+}
+
+size_t ReplaySensorProvider::pollBatch(SensorFrame* out, size_t capacity) {
+  size_t count = 0;
+  if (mode_ == Mode::Fast) {
+    while (count < capacity && nextFrame(cursor_, out[count], &corrupt_rows_, &annotation_rows_)) {
+      ++count;
+    }
+  } else {
+    while (count < capacity && nextDue(out[count])) {
+      ++count;
+    }
+  }
+  frames_delivered_ += count;
+  return count;
+}
+
+void ReplaySensorProvider::reset() {
+  cursor_ = first_row_;
+  has_pending_ = false;
+  anchored_ = false;
+  frames_delivered_ = 0;
+  corrupt_rows_ = 0;
+  annotation_rows_ = 0;
+}
+
+void ReplaySensorProvider::seek(double t_sec) {
+  has_pending_ = false;
+  anchored_ = false;
+  if (!data_) {
+    return;
+  }
+  
+  // Invariants: lo is a line start and every frame before it is earlier
+  // than t_sec; the first frame at or after hi (if any) is not earlier
+  size_t lo = first_row_;
+  size_t hi = size_;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    size_t next = lineStartAtOrAfter(mid);
+    SensorFrame frame;
+    if (next >= hi || !nextFrame(next, frame)) {
+      hi = mid;  // No frame starts in [mid, hi)
+    } else if (frame.t_sec < t_sec) {
+      lo = next;  // Past that frame
+    } else {
+      hi = mid;
+    }
+  }
+  cursor_ = lo;
+}
+
+bool ReplaySensorProvider::finished() const {
+  if (has_pending_) {
+    return false;
+  }
+  // Remaining bytes may still hold only blank or corrupt rows
+  size_t offset = cursor_;
+  SensorFrame frame;
+  return !nextFrame(offset, frame);
+}
+
+bool ReplaySensorProvider::nextFrame(size_t& offset, SensorFrame& out,
+                                     uint64_t* corrupt, uint64_t* annotations) const {
+  while (offset < size_) {
+    const char* line = data_ + offset;
+    const char* eol = static_cast<const char*>(std::memchr(line, '\n', size_ - offset));
+    const char* end = eol ? eol : data_ + size_;
+    offset = eol ? static_cast<size_t>(eol - data_) + 1 : size_;
+    
+    if (end == line || (end - line == 1 && *line == '\r')) {
+      continue;  // Blank line
+    }
+    Event row;
+    if (!parseTraceRow(line, end, row)) {
+      if (corrupt) {
+        ++*corrupt;
+      }
+      continue;
+    }
+    if (row.type != Event::Type::Pose) {
+      if (annotations) {
+        ++*annotations;
+      }
+      continue;
+    }
+    out = row.frame;
+    return true;
+  }
+  return false;
+}
+
+size_t ReplaySensorProvider::lineStartAtOrAfter(size_t offset) const {
+  if (offset == 0 || offset >= size_) {
+    return offset < size_ ? offset : size_;
+  }
+  if (data_[offset - 1] == '\n') {
+    return offset;
+  }
+  const void* eol = std::memchr(data_ + offset, '\n', size_ - offset);
+  return eol ? static_cast<size_t>(static_cast<const char*>(eol) - data_) + 1 : size_;
+}
+
+bool ReplaySensorProvider::nextDue(SensorFrame& out) {
+  if (!has_pending_) {
+    pending_next_ = cursor_;
+    if (!nextFrame(pending_next_, pending_, &corrupt_rows_, &annotation_rows_)) {
+      return false;
+    }
+    has_pending_ = true;
+  }
+  
+  // The first frame after start or seek sets the time origin
+  auto now = std::chrono::steady_clock::now();
+  if (!anchored_) {
+    anchored_ = true;
+    wall_anchor_ = now;
+    trace_anchor_ = pending_.t_sec;
+  }
+  double elapsed = std::chrono::duration<double>(now - wall_anchor_).count();
+  if (pending_.t_sec - trace_anchor_ > elapsed) {
+    return false;
+  }
+  
+  out = pending_;
+  cursor_ = pending_next_;
+  has_pending_ = false;
+  return true;
+}
+
+} // namespace infrastructure
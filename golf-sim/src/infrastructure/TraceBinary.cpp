@@ -0,0 +1,582 @@
+#include "infrastructure/TraceBinary.hpp"
+#include "infrastructure/TraceCsv.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace infrastructure {
+
+namespace {
+
+constexpr char MAGIC[8] = {'G', 'S', 'T', 'R', 'A', 'C', 'E', 'B'};
+constexpr char END_MAGIC[8] = {'G', 'S', 'T', 'R', 'E', 'N', 'D', '1'};
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t BLOCK_MAGIC = 0x4b425347;  // "GSBK"
+constexpr uint32_t INDEX_MAGIC = 0x58495347;  // "GSIX"
+
+// magic, version, block_records, three steps, reserved, CRC
+constexpr size_t HEADER_BYTES = 8 + 4 + 4 + 3 * 8 + 4 + 4;
+// magic, count, payload length, first tick ... CRC
+constexpr size_t BLOCK_HEAD_BYTES = 4 + 4 + 4 + 8;
+constexpr size_t BLOCK_OVERHEAD = BLOCK_HEAD_BYTES + 4;
+constexpr size_t INDEX_ENTRY_BYTES = 8 + 8 + 4;
+constexpr size_t FOOTER_BYTES = 8 + 8 + 8;
+
+// Every row costs at least one varint byte for its time and one per
+// channel, so a count the payload cannot hold is a hostile or damaged
+// header; reject it before sizing anything from it
+constexpr uint64_t MIN_ROW_BYTES = 7;
+
+bool plausibleCount(uint64_t count, uint64_t payload) {
+  return count > 0 && count <= payload / MIN_ROW_BYTES;
+}
+
+// Below 2^62, so the delta of any two quantized values fits in int64
+constexpr double MAX_QUANTA = 4.0e18;
+
+float SensorFrame::* const CHANNELS[6] = {
+  &SensorFrame::ax, &SensorFrame::ay, &SensorFrame::az,
+  &SensorFrame::gx, &SensorFrame::gy, &SensorFrame::gz
+};
+
+double channelStep(const TraceBinaryConfig& config, size_t channel) {
+  return channel < 3 ? config.accel_step : config.gyro_step;
+}
+
+// CRC-32 (IEEE 802.3, as in zlib)
+uint32_t crc32(const uint8_t* data, size_t length) {
+  static const std::array<uint32_t, 256> table = [] {
+    std::array<uint32_t, 256> t{};
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; ++k) {
+        c = (c & 1u) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+      }
+      t[i] = c;
+    }
+    return t;
+  }();
+  uint32_t crc = 0xffffffffu;
+  for (size_t i = 0; i < length; ++i) {
+    crc = table[(crc ^ data[i]) & 0xffu] ^ (crc >> 8);
+  }
+  return crc ^ 0xffffffffu;
+}
+
+void putU32(std::vector<uint8_t>& out, uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+void putU64(std::vector<uint8_t>& out, uint64_t value) {
+  for (int i = 0; i < 8; ++i) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+void putF64(std::vector<uint8_t>& out, double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  putU64(out, bits);
+}
+
+uint32_t getU32(const uint8_t* p) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    value |= static_cast<uint32_t>(p[i]) << (8 * i);
+  }
+  return value;
+}
+
+uint64_t getU64(const uint8_t* p) {
+  uint64_t value = 0;
+  for (int i = 0; i < 8; ++i) {
+    value |= static_cast<uint64_t>(p[i]) << (8 * i);
+  }
+  return value;
+}
+
+double getF64(const uint8_t* p) {
+  uint64_t bits = getU64(p);
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Small magnitudes of either sign become small unsigned numbers
+uint64_t zigzag(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t unzigzag(uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1u);
+}
+
+// LEB128: 7 bits per byte, high bit set on all but the last
+void putVarint(std::vector<uint8_t>& out, uint64_t value) {
+  while (value >= 0x80u) {
+    out.push_back(static_cast<uint8_t>(value | 0x80u));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+bool getVarint(const uint8_t*& p, const uint8_t* end, uint64_t& out) {
+  // Most deltas fit in one or two bytes
+  if (p < end && p[0] < 0x80u) {
+    out = *p++;
+    return true;
+  }
+  if (end - p >= 2 && p[1] < 0x80u) {
+    out = static_cast<uint64_t>(p[0] & 0x7fu) | static_cast<uint64_t>(p[1]) << 7;
+    p += 2;
+    return true;
+  }
+  uint64_t value = 0;
+  for (int shift = 0; shift < 64 && p < end; shift += 7) {
+    uint8_t byte = *p++;
+    value |= static_cast<uint64_t>(byte & 0x7fu) << shift;
+    if (!(byte & 0x80u)) {
+      out = value;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool quantize(double value, double step, int64_t& out) {
+  double quanta = std::round(value / step);
+  if (!(std::fabs(quanta) <= MAX_QUANTA)) {
+    return false;  // Also NaN
+  }
+  out = static_cast<int64_t>(quanta);
+  return true;
+}
+
+bool validStep(double step) {
+  return std::isfinite(step) && step > 0.0;
+}
+
+uint64_t fileSize(const std::string& path) {
+  struct stat st;
+  return stat(path.c_str(), &st) == 0 ? static_cast<uint64_t>(st.st_size) : 0;
+}
+
+} // namespace
+
+TraceBinaryWriter::TraceBinaryWriter(const std::string& path, const TraceBinaryConfig& config)
+  : config_(config) {
+  if (config_.block_records == 0) {
+    config_.block_records = 1;
+  }
+  if (!validStep(config_.time_step) || !validStep(config_.accel_step) || !validStep(config_.gyro_step)) {
+    config_ = TraceBinaryConfig{config_.block_records};
+  }
+  file_ = std::fopen(path.c_str(), "wb");
+  if (!file_) {
+    ok_ = false;
+    return;
+  }
+  for (std::vector<int64_t>& column : columns_) {
+    column.reserve(config_.block_records);
+  }
+  types_.reserve(config_.block_records);
+  
+  std::vector<uint8_t> header(MAGIC, MAGIC + sizeof(MAGIC));
+  putU32(header, VERSION);
+  putU32(header, config_.block_records);
+  putF64(header, config_.time_step);
+  putF64(header, config_.accel_step);
+  putF64(header, config_.gyro_step);
+  putU32(header, 0);  // Reserved
+  putU32(header, crc32(header.data(), header.size()));
+  writeBytes(header);
+}
+
+TraceBinaryWriter::~TraceBinaryWriter() {
+  finish();
+}
+
+bool TraceBinaryWriter::append(const Event& event) {
+  if (!file_) {
+    return false;
+  }
+  int64_t quanta[7];
+  const SensorFrame& f = event.frame;
+  bool representable = static_cast<uint32_t>(event.type) <= static_cast<uint32_t>(Event::Type::SwingEnd)
+    && quantize(event.t_sec, config_.time_step, quanta[0]);
+  for (size_t c = 0; c < 6 && representable; ++c) {
+    representable = quantize(f.*CHANNELS[c], channelStep(config_, c), quanta[c + 1]);
+  }
+  if (!representable) {
+    ++rejected_;
+    return false;
+  }
+  
+  for (size_t c = 0; c < 7; ++c) {
+    columns_[c].push_back(quanta[c]);
+  }
+  types_.push_back(static_cast<uint8_t>(event.type));
+  ++records_;
+  if (types_.size() == config_.block_records) {
+    flushBlock();
+  }
+  return true;
+}
+
+bool TraceBinaryWriter::finish() {
+  if (!file_) {
+    return ok_;
+  }
+  flushBlock();
+  
+  // Index, then the footer that locates it
+  uint64_t index_offset = offset_;
+  encoded_.clear();
+  putU32(encoded_, INDEX_MAGIC);
+  putU32(encoded_, static_cast<uint32_t>(index_.size()));
+  for (const IndexEntry& entry : index_) {
+    putU64(encoded_, entry.offset);
+    putU64(encoded_, static_cast<uint64_t>(entry.first_tick));
+    putU32(encoded_, entry.count);
+  }
+  putU32(encoded_, crc32(encoded_.data(), encoded_.size()));
+  putU64(encoded_, index_offset);
+  putU64(encoded_, records_);
+  encoded_.insert(encoded_.end(), END_MAGIC, END_MAGIC + sizeof(END_MAGIC));
+  writeBytes(encoded_);
+  
+  ok_ = std::fclose(file_) == 0 && ok_;
+  file_ = nullptr;
+  return ok_;
+}
+
+bool TraceBinaryWriter::flushBlock() {
+  size_t count = types_.size();
+  if (count == 0) {
+    return true;
+  }
+  int64_t first_tick = columns_[0][0];
+  encoded_.clear();
+  putU32(encoded_, BLOCK_MAGIC);
+  putU32(encoded_, static_cast<uint32_t>(count));
+  putU32(encoded_, 0);  // Payload length, filled in below
+  putU64(encoded_, static_cast<uint64_t>(first_tick));
+  
+  // Time deltas from the first tick
+  int64_t previous = first_tick;
+  for (int64_t tick : columns_[0]) {
+    putVarint(encoded_, zigzag(tick - previous));
+    previous = tick;
+  }
+  // Types as runs (nearly all Pose)
+  for (size_t i = 0; i < count;) {
+    size_t j = i;
+    while (j < count && types_[j] == types_[i]) {
+      ++j;
+    }
+    encoded_.push_back(types_[i]);
+    putVarint(encoded_, j - i);
+    i = j;
+  }
+  // Channel deltas, each column starting from zero
+  for (size_t c = 1; c < 7; ++c) {
+    previous = 0;
+    for (int64_t value : columns_[c]) {
+      putVarint(encoded_, zigzag(value - previous));
+      previous = value;
+    }
+  }
+  
+  uint32_t payload = static_cast<uint32_t>(encoded_.size() - BLOCK_HEAD_BYTES);
+  for (int i = 0; i < 4; ++i) {
+    encoded_[8 + i] = static_cast<uint8_t>(payload >> (8 * i));
+  }
+  // Everything after the magic
+  putU32(encoded_, crc32(encoded_.data() + 4, encoded_.size() - 4));
+  
+  index_.push_back(IndexEntry{offset_, first_tick, static_cast<uint32_t>(count)});
+  for (std::vector<int64_t>& column : columns_) {
+    column.clear();
+  }
+  types_.clear();
+  return writeBytes(encoded_);
+}
+
+bool TraceBinaryWriter::writeBytes(const std::vector<uint8_t>& bytes) {
+  if (std::fwrite(bytes.data(), 1, bytes.size(), file_) != bytes.size()) {
+    ok_ = false;
+    return false;
+  }
+  offset_ += bytes.size();
+  return true;
+}
+
+TraceBinaryReader::TraceBinaryReader(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(HEADER_BYTES)) {
+    close(fd);
+    return;
+  }
+  size_t length = static_cast<size_t>(st.st_size);
+  void* base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // The mapping keeps the file referenced
+  if (base == MAP_FAILED) {
+    return;
+  }
+  data_ = static_cast<const uint8_t*>(base);
+  size_ = length;
+  
+  if (!readHeader()) {
+    munmap(const_cast<uint8_t*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+    return;
+  }
+  indexed_ = loadIndex();
+  if (!indexed_) {
+    scanBlocks();
+  }
+  for (const Block& block : blocks_) {
+    record_count_ += block.count;
+  }
+}
+
+TraceBinaryReader::~TraceBinaryReader() {
+  if (data_) {
+    munmap(const_cast<uint8_t*>(data_), size_);
+  }
+}
+
+bool TraceBinaryReader::readHeader() {
+  if (std::memcmp(data_, MAGIC, sizeof(MAGIC)) != 0
+      || getU32(data_ + 8) != VERSION
+      || getU32(data_ + HEADER_BYTES - 4) != crc32(data_, HEADER_BYTES - 4)) {
+    return false;
+  }
+  config_.block_records = getU32(data_ + 12);
+  config_.time_step = getF64(data_ + 16);
+  config_.accel_step = getF64(data_ + 24);
+  config_.gyro_step = getF64(data_ + 32);
+  return validStep(config_.time_step) && validStep(config_.accel_step) && validStep(config_.gyro_step);
+}
+
+bool TraceBinaryReader::loadIndex() {
+  if (size_ < HEADER_BYTES + FOOTER_BYTES) {
+    return false;
+  }
+  const uint8_t* footer = data_ + size_ - FOOTER_BYTES;
+  if (std::memcmp(footer + 16, END_MAGIC, sizeof(END_MAGIC)) != 0) {
+    return false;
+  }
+  uint64_t index_offset = getU64(footer);
+  uint64_t index_end = size_ - FOOTER_BYTES;
+  if (index_offset < HEADER_BYTES || index_offset > index_end || index_end - index_offset < 12) {
+    return false;
+  }
+  const uint8_t* index = data_ + index_offset;
+  uint64_t count = getU32(index + 4);
+  if (getU32(index) != INDEX_MAGIC || index_end - index_offset != 8 + count * INDEX_ENTRY_BYTES + 4
+      || getU32(data_ + index_end - 4) != crc32(index, index_end - index_offset - 4)) {
+    return false;
+  }
+  
+  uint64_t total = 0;
+  std::vector<Block> blocks;
+  blocks.reserve(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    const uint8_t* entry = index + 8 + i * INDEX_ENTRY_BYTES;
+    Block block{static_cast<size_t>(getU64(entry)), static_cast<int64_t>(getU64(entry + 8)), getU32(entry + 16)};
+    if (block.offset < HEADER_BYTES || block.offset > index_offset - BLOCK_OVERHEAD
+        || !plausibleCount(block.count, index_offset - BLOCK_OVERHEAD - block.offset)) {
+      return false;
+    }
+    total += block.count;
+    blocks.push_back(block);
+  }
+  if (total != getU64(footer + 8)) {
+    return false;
+  }
+  blocks_ = std::move(blocks);
+  return true;
+}
+
+void TraceBinaryReader::scanBlocks() {
+  // Walk block headers until something that is not a whole block
+  size_t offset = HEADER_BYTES;
+  while (size_ - offset >= BLOCK_OVERHEAD) {
+    const uint8_t* p = data_ + offset;
+    uint64_t payload = getU32(p + 8);
+    if (getU32(p) != BLOCK_MAGIC || payload > size_ - offset - BLOCK_OVERHEAD
+        || !plausibleCount(getU32(p + 4), payload)) {
+      break;
+    }
+    blocks_.push_back(Block{offset, static_cast<int64_t>(getU64(p + 12)), getU32(p + 4)});
+    offset += BLOCK_OVERHEAD + payload;
+  }
+}
+
+bool TraceBinaryReader::readBlock(size_t index, std::vector<Event>& out) const {
+  out.clear();
+  if (index >= blocks_.size()) {
+    return false;
+  }
+  const Block& block = blocks_[index];
+  const uint8_t* p = data_ + block.offset;
+  uint64_t payload = getU32(p + 8);
+  if (getU32(p) != BLOCK_MAGIC || getU32(p + 4) != block.count
+      || static_cast<int64_t>(getU64(p + 12)) != block.first_tick
+      || payload > size_ - block.offset - BLOCK_OVERHEAD || !plausibleCount(block.count, payload)
+      || getU32(p + BLOCK_HEAD_BYTES + payload) != crc32(p + 4, BLOCK_HEAD_BYTES - 4 + payload)) {
+    return false;
+  }
+  
+  size_t count = block.count;
+  out.resize(count);
+  const uint8_t* in = p + BLOCK_HEAD_BYTES;
+  const uint8_t* end = in + payload;
+  uint64_t raw = 0;
+  bool ok = true;
+  
+  // Sums wrap rather than overflow on hostile (CRC-valid) deltas
+  int64_t tick = block.first_tick;
+  for (size_t i = 0; i < count; ++i) {
+    if (!getVarint(in, end, raw)) {
+      ok = false;
+      break;
+    }
+    tick = static_cast<int64_t>(static_cast<uint64_t>(tick) + static_cast<uint64_t>(unzigzag(raw)));
+    double t = static_cast<double>(tick) * config_.time_step;
+    out[i].t_sec = t;
+    out[i].frame.t_sec = t;
+  }
+  for (size_t i = 0; i < count && ok;) {
+    uint64_t run = 0;
+    ok = in < end && *in <= static_cast<uint8_t>(Event::Type::SwingEnd);
+    Event::Type type = ok ? static_cast<Event::Type>(*in++) : Event::Type::Pose;
+    ok = ok && getVarint(in, end, run) && run > 0 && run <= count - i;
+    for (size_t j = 0; j < run && ok; ++j) {
+      out[i++].type = type;
+    }
+  }
+  for (size_t c = 0; c < 6 && ok; ++c) {
+    float SensorFrame::* member = CHANNELS[c];
+    double step = channelStep(config_, c);
+    int64_t value = 0;
+    for (size_t i = 0; i < count; ++i) {
+      if (!getVarint(in, end, raw)) {
+        ok = false;
+        break;
+      }
+      value = static_cast<int64_t>(static_cast<uint64_t>(value) + static_cast<uint64_t>(unzigzag(raw)));
+      out[i].frame.*member = static_cast<float>(static_cast<double>(value) * step);
+    }
+  }
+  if (!ok || in != end) {
+    out.clear();
+    return false;
+  }
+  return true;
+}
+
+size_t TraceBinaryReader::findBlock(double t_sec) const {
+  // Blocks starting before t_sec; the row is in the last of them or starts the next
+  double target = std::ceil(t_sec / config_.time_step);
+  size_t lo = 0;
+  size_t hi = blocks_.size();
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (static_cast<double>(blocks_[mid].first_tick) < target) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo > 0 ? lo - 1 : 0;
+}
+
+bool isBinaryTrace(const std::string& path) {
+  char magic[sizeof(MAGIC)];
+  std::ifstream file(path, std::ios::binary);
+  return file.read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+bool convertCsvToBinary(const std::string& csv_path, const std::string& binary_path,
+                        const TraceBinaryConfig& config, TraceConvertStats& stats) {
+  std::ifstream in(csv_path, std::ios::binary);
+  if (!in) {
+    return false;
+  }
+  TraceBinaryWriter writer(binary_path, config);
+  if (!writer.isOpen()) {
+    return false;
+  }
+  
+  std::string line;
+  size_t header = std::strlen(TRACE_CSV_HEADER);
+  bool first = true;
+  while (std::getline(in, line)) {
+    bool is_header = first && line.compare(0, header, TRACE_CSV_HEADER) == 0;
+    first = false;
+    if (is_header || line.empty() || line == "\r") {
+      continue;
+    }
+    Event event;
+    if (parseTraceRow(line.data(), line.data() + line.size(), event) && writer.append(event)) {
+      ++stats.rows;
+    } else {
+      ++stats.skipped_rows;
+    }
+  }
+  bool ok = writer.finish();
+  stats.bytes_in = fileSize(csv_path);
+  stats.bytes_out = writer.bytesWritten();
+  return ok;
+}
+
+bool convertBinaryToCsv(const std::string& binary_path, const std::string& csv_path,
+                        TraceConvertStats& stats) {
+  TraceBinaryReader reader(binary_path);
+  if (!reader.isOpen()) {
+    return false;
+  }
+  std::FILE* out = std::fopen(csv_path.c_str(), "wb");
+  if (!out) {
+    return false;
+  }
+  
+  std::string header = std::string(TRACE_CSV_HEADER) + "\n";
+  bool ok = std::fwrite(header.data(), 1, header.size(), out) == header.size();
+  std::vector<Event> rows;
+  std::vector<char> text;
+  for (size_t b = 0; b < reader.blockCount() && ok; ++b) {
+    if (!reader.readBlock(b, rows)) {
+      ++stats.bad_blocks;
+      continue;
+    }
+    text.resize(rows.size() * TRACE_CSV_MAX_ROW);
+    size_t length = 0;
+    for (const Event& row : rows) {
+      length += formatTraceRow(row, text.data() + length);
+    }
+    ok = std::fwrite(text.data(), 1, length, out) == length;
+    stats.rows += rows.size();
+  }
+  ok = std::fclose(out) == 0 && ok;
+  stats.bytes_in = reader.sizeBytes();
+  stats.bytes_out = fileSize(csv_path);
+  return ok;
+}
+
+} // namespace infrastructure
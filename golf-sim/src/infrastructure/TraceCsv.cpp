@@ -0,0 +1,95 @@
+#include "infrastructure/TraceCsv.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace infrastructure {
+
+namespace {
+
+const char* const TYPE_NAMES[] = {"Pose", "SwingStart", "Impact", "SwingEnd"};
+
+// One number, then the separator (or the end of the row for the last one)
+template <typename T>
+bool parseField(const char*& p, const char* end, bool last, T& out) {
+  auto result = std::from_chars(p, end, out);
+  if (result.ec != std::errc() || !std::isfinite(out)) {
+    return false;
+  }
+  p = result.ptr;
+  if (last) {
+    return p == end;
+  }
+  if (p == end || *p != ',') {
+    return false;
+  }
+  ++p;
+  return true;
+}
+
+template <typename T>
+char* formatField(char* p, T value) {
+  *p++ = ',';
+  return std::to_chars(p, p + 32, value).ptr;
+}
+
+} // namespace
+
+const char* eventTypeName(Event::Type type) {
+  size_t index = static_cast<size_t>(type);
+  return index < sizeof(TYPE_NAMES) / sizeof(TYPE_NAMES[0]) ? TYPE_NAMES[index] : "Unknown";
+}
+
+bool parseEventType(const char* begin, const char* end, Event::Type& out) {
+  size_t length = static_cast<size_t>(end - begin);
+  for (size_t i = 0; i < sizeof(TYPE_NAMES) / sizeof(TYPE_NAMES[0]); ++i) {
+    if (std::strlen(TYPE_NAMES[i]) == length && std::memcmp(TYPE_NAMES[i], begin, length) == 0) {
+      out = static_cast<Event::Type>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t formatTraceRow(const Event& event, char* out) {
+  char* p = std::to_chars(out, out + 32, event.t_sec).ptr;
+  *p++ = ',';
+  const char* name = eventTypeName(event.type);
+  size_t length = std::strlen(name);
+  std::memcpy(p, name, length);
+  p += length;
+  const SensorFrame& f = event.frame;
+  p = formatField(p, f.ax);
+  p = formatField(p, f.ay);
+  p = formatField(p, f.az);
+  p = formatField(p, f.gx);
+  p = formatField(p, f.gy);
+  p = formatField(p, f.gz);
+  *p++ = '\n';
+  return static_cast<size_t>(p - out);
+}
+
+bool parseTraceRow(const char* begin, const char* end, Event& out) {
+  if (end > begin && end[-1] == '\r') {
+    --end;
+  }
+  const char* p = begin;
+  if (!parseField(p, end, false, out.t_sec)) {
+    return false;
+  }
+  const char* comma = static_cast<const char*>(std::memchr(p, ',', static_cast<size_t>(end - p)));
+  if (!comma || !parseEventType(p, comma, out.type)) {
+    return false;
+  }
+  p = comma + 1;
+  SensorFrame& f = out.frame;
+  f.t_sec = out.t_sec;
+  return parseField(p, end, false, f.ax)
+      && parseField(p, end, false, f.ay)
+      && parseField(p, end, false, f.az)
+      && parseField(p, end, false, f.gx)
+      && parseField(p, end, false, f.gy)
+      && parseField(p, end, true, f.gz);
+}
+
+} // namespace infrastructure
@@ -0,0 +1,191 @@
+#include "infrastructure/TraceRecorder.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace infrastructure {
+
+namespace {
+
+// Whole buffer, retrying short writes
+bool writeAll(int fd, const char* data, size_t length) {
+  while (length > 0) {
+    ssize_t n = ::write(fd, data, length);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += n;
+    length -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+} // namespace
+
+TraceRecorder::TraceRecorder(const std::string& path, const TraceRecorderConfig& config)
+  : config_(config) {
+  if (config_.buffer_records == 0) {
+    config_.buffer_records = 1;
+  }
+  buffers_[0].resize(config_.buffer_records);
+  buffers_[1].resize(config_.buffer_records);
+  text_.resize(config_.buffer_records * TRACE_CSV_MAX_ROW);
+  
+  fd_ = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd_ >= 0) {
+    std::string header = std::string(TRACE_CSV_HEADER) + "\n";
+    if (!writeAll(fd_, header.data(), header.size())) {
+      write_error_.store(true);
+    }
+  }
+}
+
+TraceRecorder::~TraceRecorder() {
+  stop();
+  if (fd_ >= 0) {
+    close(fd_);
+  }
+}
+
+void TraceRecorder::start() {
+  if (running_.exchange(true)) {
+    return;
+  }
+  thread_ = std::thread([this] { run(); });
+}
+
+void TraceRecorder::stop() {
+  flush();
+  if (!thread_.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wake_writer_.notify_one();
+  thread_.join();
+  stopping_ = false;
+  running_.store(false);
+}
+
+bool TraceRecorder::record(const SensorFrame& frame) {
+  Event event;
+  event.type = Event::Type::Pose;
+  event.t_sec = frame.t_sec;
+  event.frame = frame;
+  return record(event);
+}
+
+bool TraceRecorder::record(const Event& event) {
+  if (fill_ == config_.buffer_records) {
+    if (!handOff()) {
+      // The writer still has the other buffer: drop rather than wait
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      if (!stalled_) {
+        stalled_ = true;
+        backpressure_.fetch_add(1, std::memory_order_relaxed);
+      }
+      return false;
+    }
+    stalled_ = false;
+  }
+  buffers_[active_][fill_++] = event;
+  recorded_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void TraceRecorder::flush() {
+  waitForWriter();
+  if (fill_ > 0) {
+    handOff();
+    waitForWriter();
+  }
+}
+
+TraceRecorderStats TraceRecorder::stats() const {
+  TraceRecorderStats s;
+  s.recorded = recorded_.load(std::memory_order_relaxed);
+  s.written = written_records_.load(std::memory_order_relaxed);
+  s.dropped = dropped_.load(std::memory_order_relaxed);
+  s.backpressure = backpressure_.load(std::memory_order_relaxed);
+  s.flushes = flushes_.load(std::memory_order_relaxed);
+  s.bytes_written = bytes_written_.load(std::memory_order_relaxed);
+  s.write_error = write_error_.load(std::memory_order_relaxed);
+  return s;
+}
+
+bool TraceRecorder::handOff() {
+  if (writer_busy_.load(std::memory_order_acquire)) {
+    return false;
+  }
+  writer_busy_.store(true, std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_ = true;
+    pending_index_ = active_;
+    pending_count_ = fill_;
+  }
+  wake_writer_.notify_one();
+  active_ ^= 1;
+  fill_ = 0;
+  return true;
+}
+
+void TraceRecorder::waitForWriter() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (thread_.joinable()) {
+    written_.wait(lock, [this] { return !pending_; });
+    return;
+  }
+  // No writer thread: write on the caller's thread
+  if (pending_) {
+    writeOut(pending_index_, pending_count_);
+    pending_ = false;
+    writer_busy_.store(false, std::memory_order_release);
+  }
+}
+
+void TraceRecorder::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    wake_writer_.wait(lock, [this] { return pending_ || stopping_; });
+    if (!pending_) {
+      return;  // Stopping with nothing left
+    }
+    size_t index = pending_index_;
+    size_t count = pending_count_;
+    lock.unlock();
+    writeOut(index, count);
+    lock.lock();
+    pending_ = false;
+    writer_busy_.store(false, std::memory_order_release);
+    written_.notify_all();
+  }
+}
+
+void TraceRecorder::writeOut(size_t index, size_t count) {
+  if (fd_ < 0 || count == 0) {
+    return;
+  }
+  const std::vector<Event>& records = buffers_[index];
+  char* out = text_.data();
+  size_t length = 0;
+  for (size_t i = 0; i < count; ++i) {
+    length += formatTraceRow(records[i], out + length);
+  }
+  if (!writeAll(fd_, out, length)) {
+    write_error_.store(true, std::memory_order_relaxed);
+    return;
+  }
+  written_records_.fetch_add(count, std::memory_order_relaxed);
+  flushes_.fetch_add(1, std::memory_order_relaxed);
+  bytes_written_.fetch_add(length, std::memory_order_relaxed);
+}
+
+} // namespace infrastructure
@@ -162,6 +162,40 @@ void Renderer::drawTrajectory(const GreenData& green) {
   }
 }
 
+void Renderer::drawPredictedArc(const GreenData& green) {
+  if (green.predicted_arc.size() < 2) return;
+  
+  // Dashed: every other segment
+  Color arc_color = {120, 220, 255, 180};
+  for (size_t i = 0; i + 1 < green.predicted_arc.size(); i += 2) {
+    Vector2 p1 = mapGreenCoordToScreen(green.predicted_arc[i].x, green.predicted_arc[i].y);
+    Vector2 p2 = mapGreenCoordToScreen(green.predicted_arc[i + 1].x, green.predicted_arc[i + 1].y);
+    DrawLineEx(p1, p2, 2, arc_color);
+  }
+  
+  Vector2 end_pos = mapGreenCoordToScreen(green.predicted_arc.back().x, green.predicted_arc.back().y);
+  DrawCircleLines((int)end_pos.x, (int)end_pos.y, 6, arc_color);
+}
+
+void Renderer::drawDispersion(const GreenData& green) {
+  for (const BallPosition& landing : green.dispersion_cloud) {
+    Vector2 p = mapGreenCoordToScreen(landing.x, landing.y);
+    DrawCircle((int)p.x, (int)p.y, 2, {255, 255, 255, 90});
+  }
+  
+  // Inner contour brighter than the outer one
+  for (size_t c = 0; c < green.dispersion_contours.size(); c++) {
+    const std::vector<BallPosition>& outline = green.dispersion_contours[c];
+    unsigned char alpha = (unsigned char)(c == 0 ? 220 : 140);
+    Color contour_color = {255, 230, 120, alpha};
+    for (size_t i = 0; i + 1 < outline.size(); i++) {
+      Vector2 p1 = mapGreenCoordToScreen(outline[i].x, outline[i].y);
+      Vector2 p2 = mapGreenCoordToScreen(outline[i + 1].x, outline[i + 1].y);
+      DrawLineEx(p1, p2, 2, contour_color);
+    }
+  }
+}
+
 void Renderer::drawCurrentBall(const GreenData& green) {
   Vector2 ball_pos = mapGreenCoordToScreen(green.current_ball_pos.x, green.current_ball_pos.y);
   
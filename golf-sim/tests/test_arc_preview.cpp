@@ -0,0 +1,172 @@
+#include "application/ArcPreviewService.hpp"
+#include "domain/PhysicsEngine.hpp"
+#include <iostream>
+#include <cmath>
+#include <memory>
+#include <cassert>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+namespace {
+
+domain::PhysicsConfig makeConfig() {
+  domain::PhysicsConfig config;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  config.wind_velocity = domain::Vec3(1.0, 0.0, 0.0);
+  return config;
+}
+
+application::ShotParameters makeParams(float power, float aim) {
+  application::ShotParameters params;
+  params.club_index = 2;
+  params.power = power;
+  params.aim_angle_deg = aim;
+  return params;
+}
+
+} // namespace
+
+TEST(arc_matches_flight) {
+  application::ShotParameterService shots;
+  domain::PhysicsConfig config = makeConfig();
+  application::ArcPreviewService preview(shots, config);
+  
+  application::ShotParameters params = makeParams(0.8f, 2.0f);
+  const auto& arc = preview.update(params);
+  assert(!preview.isPending());
+  assert(arc.size() > 10);
+  assert(arc.front().y == 0.0f && arc.front().z == 0.0f);
+  
+  // Landing close to the full-rate simulation
+  config.integrator = domain::PhysicsConfig::Integrator::RK45;
+  domain::PhysicsEngine engine(config);
+  engine.startShot(shots.createLaunchCondition(params));
+  engine.step(config.max_flight_time_sec);
+  domain::Vec3 landing = engine.calculateResult().landing_position;
+  assert(std::abs(arc.back().x - landing.x) < 0.05);
+  assert(std::abs(arc.back().y - landing.y) < 0.05);
+  assert(arc.back().z == 0.0f);
+}
+
+TEST(arc_memoized_by_quantized_params) {
+  application::ShotParameterService shots;
+  application::ArcPreviewService preview(shots, makeConfig());
+  
+  preview.update(makeParams(0.8f, 0.0f));
+  assert(preview.getComputeCount() == 1);
+  
+  // Within one quantum: same arc, nothing recomputed
+  preview.update(makeParams(0.8012f, 0.1f));
+  assert(preview.getComputeCount() == 1);
+  
+  // New parameters, then back: the old arc comes from the cache
+  float y_first = preview.getArc().back().y;
+  preview.update(makeParams(0.6f, 0.0f));
+  assert(preview.getComputeCount() == 2);
+  assert(preview.getArc().back().y < y_first);
+  preview.update(makeParams(0.8f, 0.0f));
+  assert(preview.getComputeCount() == 2);
+  assert(preview.getCacheHits() == 1);
+  assert(preview.getArc().back().y == y_first);
+}
+
+TEST(arc_spreads_work_across_frames) {
+  application::ShotParameterService shots;
+  application::ArcPreviewConfig config;
+  config.max_steps_per_frame = 30;  // Half a second of flight per frame
+  application::ArcPreviewService preview(shots, makeConfig(), config);
+  
+  // Nothing to show until the first arc lands
+  assert(preview.update(makeParams(0.8f, 0.0f)).empty());
+  assert(preview.isPending());
+  int frames = 1;
+  while (preview.isPending()) {
+    preview.update(makeParams(0.8f, 0.0f));
+    ++frames;
+  }
+  assert(frames > 5);
+  size_t first_size = preview.getArc().size();
+  float first_y = preview.getArc().back().y;
+  
+  // While the next arc is computed the last good arc stays on screen
+  preview.update(makeParams(0.5f, 0.0f));
+  assert(preview.isPending());
+  assert(preview.getArc().size() == first_size);
+  assert(preview.getArc().back().y == first_y);
+  
+  // Fast input: the arc in progress finishes, then the newest request runs
+  preview.update(makeParams(0.55f, 0.0f));
+  preview.update(makeParams(0.6f, 0.0f));
+  while (preview.isPending()) {
+    preview.update(makeParams(0.6f, 0.0f));
+  }
+  assert(preview.getComputeCount() == 3);  // 0.8, 0.5, 0.6 (0.55 skipped)
+  assert(preview.getArc().back().y < first_y);
+}
+
+TEST(arc_cache_evicts_least_recent) {
+  application::ShotParameterService shots;
+  application::ArcPreviewConfig config;
+  config.cache_entries = 2;
+  application::ArcPreviewService preview(shots, makeConfig(), config);
+  
+  preview.update(makeParams(0.5f, 0.0f));
+  preview.update(makeParams(0.6f, 0.0f));
+  preview.update(makeParams(0.5f, 0.0f));   // Hit: 0.6 is now least recent
+  preview.update(makeParams(0.7f, 0.0f));   // Evicts 0.6
+  assert(preview.getComputeCount() == 3);
+  preview.update(makeParams(0.5f, 0.0f));
+  assert(preview.getComputeCount() == 3);
+  preview.update(makeParams(0.6f, 0.0f));
+  assert(preview.getComputeCount() == 4);
+}
+
+TEST(arc_follows_wind_field) {
+  application::ShotParameterService shots;
+  domain::PhysicsConfig config = makeConfig();
+  application::ArcPreviewService preview(shots, config);
+  application::ShotParameters params = makeParams(0.8f, 0.0f);
+  preview.update(params);
+  float calm_x = preview.getArc().back().x;
+  
+  domain::WindFieldConfig wind;
+  wind.speed_mps = 8.0;
+  wind.direction_deg = 0.0;  // Toward +x
+  auto field = std::make_shared<const domain::WindField>(wind);
+  preview.setWindField(field);
+  
+  // Old arc stays up until the same parameters are recomputed in the new wind
+  assert(preview.getArc().back().x == calm_x);
+  preview.update(params);
+  assert(!preview.isPending());
+  assert(preview.getComputeCount() == 2);
+  
+  config.integrator = domain::PhysicsConfig::Integrator::RK45;
+  domain::PhysicsEngine engine(config);
+  engine.setWindField(field.get());
+  engine.startShot(shots.createLaunchCondition(params));
+  engine.step(config.max_flight_time_sec);
+  domain::Vec3 landing = engine.calculateResult().landing_position;
+  assert(landing.x > calm_x + 2.0);
+  assert(std::abs(preview.getArc().back().x - landing.x) < 0.1);
+  assert(std::abs(preview.getArc().back().y - landing.y) < 0.1);
+}
+
+int main() {
+  std::cout << "=== Arc Preview Tests ===" << std::endl;
+  
+  RUN_TEST(arc_matches_flight);
+  RUN_TEST(arc_memoized_by_quantized_params);
+  RUN_TEST(arc_spreads_work_across_frames);
+  RUN_TEST(arc_cache_evicts_least_recent);
+  RUN_TEST(arc_follows_wind_field);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,159 @@
+#include "domain/BallBatch.hpp"
+#include "domain/PhysicsEngine.hpp"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cassert>
+#include <vector>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+namespace {
+
+domain::PhysicsConfig makeConfig() {
+  domain::PhysicsConfig config;
+  config.gravity = 9.80665;
+  config.drag_coefficient = 0.02;
+  config.wind_velocity = domain::Vec3(1.0, -2.0, 0.0);
+  config.dt_fixed_sec = 1.0 / 240.0;
+  return config;
+}
+
+domain::LaunchCondition makeLaunch(int i) {
+  domain::LaunchCondition launch;
+  launch.launch_speed_mps = 20.0 + (i * 7) % 50;
+  launch.launch_angle_deg = 5.0 + (i * 3) % 40;
+  return launch;
+}
+
+domain::ShotResult simulateScalar(const domain::PhysicsConfig& config,
+                                  const domain::LaunchCondition& launch) {
+  domain::PhysicsEngine physics(config);
+  physics.startShot(launch);
+  while (!physics.hasLanded()) {
+    physics.step(1.0 / 60.0);
+  }
+  return physics.calculateResult();
+}
+
+} // namespace
+
+TEST(batch_matches_scalar_engine) {
+  domain::PhysicsConfig config = makeConfig();
+  domain::BallBatch batch(config);
+  
+  // Deliberately not a multiple of the lane count
+  const int count = 37;
+  for (int i = 0; i < count; ++i) {
+    assert(batch.add(makeLaunch(i)) == static_cast<size_t>(i));
+  }
+  assert(batch.activeCount() == static_cast<size_t>(count));
+  
+  batch.run();
+  assert(batch.activeCount() == 0);
+  
+  for (int i = 0; i < count; ++i) {
+    domain::ShotResult expected = simulateScalar(config, makeLaunch(i));
+    domain::ShotResult actual = batch.getResult(i);
+    
+    // Float lanes vs double scalar: within 0.1% (or 2 cm) of carry
+    double tol = std::max(0.02, expected.carry_m * 1e-3);
+    assert(std::abs(actual.carry_m - expected.carry_m) < tol);
+    assert(std::abs(actual.lateral_m - expected.lateral_m) < tol);
+    // Touchdown is interpolated inside the step by both engines
+    assert(std::abs(actual.flight_time_s - expected.flight_time_s) < 1e-3);
+  }
+}
+
+TEST(batch_retires_landed_balls) {
+  domain::PhysicsConfig config = makeConfig();
+  domain::BallBatch batch(config);
+  
+  domain::LaunchCondition short_shot;
+  short_shot.launch_speed_mps = 5.0;
+  short_shot.launch_angle_deg = 20.0;
+  domain::LaunchCondition long_shot;
+  long_shot.launch_speed_mps = 60.0;
+  long_shot.launch_angle_deg = 30.0;
+  
+  size_t a = batch.add(short_shot);
+  size_t b = batch.add(long_shot);
+  
+  // Step until the short shot lands; the long one keeps flying
+  while (batch.isInFlight(a)) {
+    assert(batch.step());
+  }
+  assert(batch.isInFlight(b));
+  domain::ShotResult frozen = batch.getResult(a);
+  
+  batch.run();
+  assert(!batch.isInFlight(b));
+  
+  // The retired ball is not advanced any further
+  domain::ShotResult after = batch.getResult(a);
+  assert(after.carry_m == frozen.carry_m);
+  assert(after.flight_time_s == frozen.flight_time_s);
+  assert(batch.getResult(b).flight_time_s > frozen.flight_time_s);
+}
+
+TEST(batch_storage_reused) {
+  domain::BallBatch batch(makeConfig());
+  for (int i = 0; i < 8; ++i) {
+    batch.add(makeLaunch(i));
+  }
+  batch.run();
+  double first = batch.getResult(3).carry_m;
+  
+  batch.clear();
+  assert(batch.size() == 0);
+  for (int i = 0; i < 8; ++i) {
+    batch.add(makeLaunch(i));
+  }
+  batch.run();
+  assert(batch.getResult(3).carry_m == first);
+}
+
+TEST(batch_throughput) {
+  // Informational: flights per second against the scalar engine
+  domain::PhysicsConfig config = makeConfig();
+  const int count = 2000;
+  
+  auto t0 = std::chrono::steady_clock::now();
+  domain::BallBatch batch(config);
+  for (int i = 0; i < count; ++i) {
+    batch.add(makeLaunch(i));
+  }
+  batch.run();
+  auto t1 = std::chrono::steady_clock::now();
+  
+  double checksum = 0.0;
+  for (int i = 0; i < count; ++i) {
+    checksum += simulateScalar(config, makeLaunch(i)).carry_m;
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  
+  double batch_s = std::chrono::duration<double>(t1 - t0).count();
+  double scalar_s = std::chrono::duration<double>(t2 - t1).count();
+  std::cout << "  batch:  " << static_cast<int>(count / batch_s) << " flights/s" << std::endl;
+  std::cout << "  scalar: " << static_cast<int>(count / scalar_s) << " flights/s"
+            << " (checksum " << checksum << ")" << std::endl;
+  assert(batch.activeCount() == 0);
+}
+
+int main() {
+  std::cout << "=== Ball Batch Tests ===" << std::endl;
+  
+  RUN_TEST(batch_matches_scalar_engine);
+  RUN_TEST(batch_retires_landed_balls);
+  RUN_TEST(batch_storage_reused);
+  RUN_TEST(batch_throughput);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,267 @@
+#include "application/DispersionService.hpp"
+#include "application/ThreadPool.hpp"
+#include "domain/PhysicsEngine.hpp"
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <cassert>
+#include <vector>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+namespace {
+
+domain::PhysicsConfig makeConfig() {
+  domain::PhysicsConfig config;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  config.wind_velocity = domain::Vec3(1.0, 0.0, 0.0);
+  return config;
+}
+
+application::ShotParameters makeParams() {
+  application::ShotParameters params;
+  params.club_index = 3;  // 7-Iron
+  params.power = 0.9f;
+  params.aim_angle_deg = 2.0f;
+  return params;
+}
+
+} // namespace
+
+TEST(thread_pool_runs_each_index_once) {
+  application::ThreadPool pool(4);
+  assert(pool.getThreadCount() == 4);
+  
+  for (size_t count : {0u, 1u, 3u, 1000u}) {
+    std::vector<std::atomic<int>> hits(count);
+    pool.parallelFor(count, [&hits](size_t i) { hits[i].fetch_add(1); });
+    for (size_t i = 0; i < count; ++i) {
+      assert(hits[i].load() == 1);
+    }
+  }
+}
+
+TEST(dispersion_reproducible_across_thread_counts) {
+  application::ShotParameterService shots;
+  application::ThreadPool single(1);
+  application::ThreadPool quad(4);
+  application::DispersionService a(shots, makeConfig(), single);
+  application::DispersionService b(shots, makeConfig(), quad);
+  
+  application::DispersionResult ra, rb;
+  a.analyze(makeParams(), 1000, 7, ra);
+  b.analyze(makeParams(), 1000, 7, rb);
+  
+  assert(ra.landings.size() == 1000);
+  for (size_t i = 0; i < ra.landings.size(); ++i) {
+    assert(ra.landings[i].x == rb.landings[i].x);
+    assert(ra.landings[i].y == rb.landings[i].y);
+  }
+  assert(ra.mean.x == rb.mean.x && ra.mean.y == rb.mean.y);
+  assert(ra.cov_xy == rb.cov_xy);
+  
+  // A different seed gives a different cloud
+  application::DispersionResult rc;
+  b.analyze(makeParams(), 1000, 8, rc);
+  assert(rc.landings[0].y != ra.landings[0].y);
+}
+
+TEST(dispersion_zero_spread_is_nominal) {
+  application::ShotParameterService shots;
+  application::ThreadPool pool(2);
+  domain::PhysicsConfig config = makeConfig();
+  application::DispersionSpread none;
+  none.speed_pct = none.launch_angle_deg = none.aim_deg = none.spin_pct = none.gust_mps = 0.0;
+  application::DispersionService service(shots, config, pool, none);
+  
+  application::DispersionResult result;
+  service.analyze(makeParams(), 100, 1, result);
+  
+  // Same as a single RK45 flight of the nominal launch
+  config.integrator = domain::PhysicsConfig::Integrator::RK45;
+  domain::PhysicsEngine engine(config);
+  engine.startShot(shots.createLaunchCondition(makeParams()));
+  engine.step(config.max_flight_time_sec);
+  domain::Vec3 nominal = engine.calculateResult().landing_position;
+  
+  assert(std::abs(result.mean.x - nominal.x) < 1e-9);
+  assert(std::abs(result.mean.y - nominal.y) < 1e-9);
+  assert(std::abs(result.cov_xx) < 1e-12 && std::abs(result.cov_yy) < 1e-12);
+  assert(result.contours.size() == 2);
+  assert(result.contours[1].semi_major_m < 1e-6);
+}
+
+TEST(dispersion_flies_wind_field) {
+  application::ShotParameterService shots;
+  application::ThreadPool pool(2);
+  domain::PhysicsConfig config = makeConfig();
+  application::DispersionSpread none;
+  none.speed_pct = none.launch_angle_deg = none.aim_deg = none.spin_pct = none.gust_mps = 0.0;
+  application::DispersionService service(shots, config, pool, none);
+  
+  domain::WindFieldConfig wind;
+  wind.speed_mps = 8.0;
+  wind.direction_deg = 0.0;  // Toward +x
+  auto field = std::make_shared<const domain::WindField>(wind);
+  service.setWindField(field);
+  application::DispersionResult result;
+  service.analyze(makeParams(), 64, 1, result);
+  
+  config.integrator = domain::PhysicsConfig::Integrator::RK45;
+  domain::PhysicsEngine engine(config);
+  engine.startShot(shots.createLaunchCondition(makeParams()));
+  engine.step(config.max_flight_time_sec);
+  domain::Vec3 calm = engine.calculateResult().landing_position;
+  engine.setWindField(field.get());
+  engine.startShot(shots.createLaunchCondition(makeParams()));
+  engine.step(config.max_flight_time_sec);
+  domain::Vec3 windy = engine.calculateResult().landing_position;
+  
+  assert(windy.x > calm.x + 2.0);
+  assert(std::abs(result.mean.x - windy.x) < 1e-9);
+  assert(std::abs(result.mean.y - windy.y) < 1e-9);
+}
+
+TEST(dispersion_requests_run_in_background) {
+  application::ShotParameterService shots;
+  application::ThreadPool pool(2);
+  application::DispersionService service(shots, makeConfig(), pool);
+  application::ShotParameters near = makeParams();
+  application::ShotParameters mid = makeParams();
+  application::ShotParameters far = makeParams();
+  near.power = 0.5f;
+  mid.power = 0.7f;
+  
+  application::DispersionResult expected_near, expected_far;
+  service.analyze(near, 256, 3, expected_near);
+  service.analyze(far, 256, 3, expected_far);
+  
+  // Held keys: a request every frame. One runs, the newest waits.
+  application::DispersionResult shown;
+  assert(!service.poll(shown));
+  service.request(near, 256, 3);
+  service.request(mid, 256, 3);
+  service.request(far, 256, 3);
+  assert(service.isBusy());
+  
+  service.wait();
+  assert(service.poll(shown));
+  assert(shown.landings.size() == 256);
+  assert(shown.mean.y == expected_near.mean.y);
+  assert(shown.landings[17].x == expected_near.landings[17].x);
+  
+  // The middle request was superseded; the newest one started on poll()
+  assert(service.isBusy());
+  service.wait();
+  assert(service.poll(shown));
+  assert(shown.mean.y == expected_far.mean.y);
+  assert(!service.isBusy());
+  assert(!service.poll(shown));
+}
+
+TEST(dispersion_new_wind_cancels_running_request) {
+  application::ShotParameterService shots;
+  application::ThreadPool pool(1);
+  application::DispersionService service(shots, makeConfig(), pool);
+  const size_t samples = 64 * application::DispersionService::CHUNK_SIZE;
+  
+  application::DispersionResult full;
+  auto t0 = std::chrono::steady_clock::now();
+  service.analyze(makeParams(), samples, 5, full);
+  double full_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+  
+  // A new hole mid-analysis: the render thread waits for one chunk at
+  // most, not for the whole cloud, and the stale cloud never shows up
+  application::DispersionResult shown;
+  service.request(makeParams(), samples, 5);
+  service.request(makeParams(), samples, 6);
+  t0 = std::chrono::steady_clock::now();
+  service.setWindField(nullptr);
+  double cancel_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+  assert(cancel_sec < full_sec * 0.25);
+  assert(!service.isBusy());
+  assert(!service.poll(shown));
+  
+  // The next request runs to completion as usual
+  service.request(makeParams(), samples, 5);
+  service.wait();
+  assert(service.poll(shown));
+  assert(shown.landings.size() == samples);
+  assert(shown.mean.y == full.mean.y);
+  (void)full_sec;
+  (void)cancel_sec;
+}
+
+TEST(dispersion_contours_cover_percentiles) {
+  application::ShotParameterService shots;
+  application::ThreadPool pool;
+  application::DispersionService service(shots, makeConfig(), pool);
+  
+  application::DispersionResult result;
+  service.analyze(makeParams(), 2000, 3, result);
+  
+  // Mean lands near the nominal shot; distance spread dominates
+  assert(result.mean.y > 70.0);
+  assert(result.cov_yy > 0.0 && result.cov_xx > 0.0);
+  
+  for (const application::DispersionContour& contour : result.contours) {
+    assert(contour.semi_major_m >= contour.semi_minor_m);
+    assert(contour.semi_minor_m > 0.0);
+    
+    // Count landings inside the ellipse
+    double c = std::cos(contour.angle_rad);
+    double s = std::sin(contour.angle_rad);
+    size_t inside = 0;
+    for (const domain::Vec3& p : result.landings) {
+      double dx = p.x - result.mean.x;
+      double dy = p.y - result.mean.y;
+      double u = (dx * c + dy * s) / contour.semi_major_m;
+      double v = (-dx * s + dy * c) / contour.semi_minor_m;
+      if (u * u + v * v <= 1.0 + 1e-9) {
+        ++inside;
+      }
+    }
+    double fraction = static_cast<double>(inside) / result.landings.size();
+    assert(fraction >= contour.percentile);
+    assert(fraction < contour.percentile + 0.01);
+  }
+  assert(result.contours[1].semi_major_m > result.contours[0].semi_major_m);
+}
+
+TEST(dispersion_throughput) {
+  // Informational: time for a full refresh at the app's sample count
+  application::ShotParameterService shots;
+  application::ThreadPool pool;
+  application::DispersionService service(shots, makeConfig(), pool);
+  application::DispersionResult result;
+  
+  auto t0 = std::chrono::steady_clock::now();
+  service.analyze(makeParams(), 2000, 11, result);
+  auto t1 = std::chrono::steady_clock::now();
+  std::cout << "  2000 shots on " << pool.getThreadCount() << " threads: "
+            << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+}
+
+int main() {
+  std::cout << "=== Dispersion Tests ===" << std::endl;
+  
+  RUN_TEST(thread_pool_runs_each_index_once);
+  RUN_TEST(dispersion_reproducible_across_thread_counts);
+  RUN_TEST(dispersion_zero_spread_is_nominal);
+  RUN_TEST(dispersion_flies_wind_field);
+  RUN_TEST(dispersion_requests_run_in_background);
+  RUN_TEST(dispersion_new_wind_cancels_running_request);
+  RUN_TEST(dispersion_contours_cover_percentiles);
+  RUN_TEST(dispersion_throughput);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,227 @@
+#include "infrastructure/EventQueue.hpp"
+#include <iostream>
+#include <chrono>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <thread>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+using infrastructure::Event;
+using infrastructure::EventQueue;
+
+namespace {
+
+// Event whose every field is derived from its sequence number, so a torn
+// or mixed-up copy is detectable
+Event makeEvent(uint64_t seq) {
+  Event e;
+  e.type = static_cast<Event::Type>(seq % 4);
+  e.t_sec = static_cast<double>(seq);
+  float f = static_cast<float>(seq & 0xffff);
+  e.frame = infrastructure::SensorFrame(e.t_sec, f, f + 1.0f, f + 2.0f, -f, -f - 1.0f, -f - 2.0f);
+  return e;
+}
+
+uint64_t checkedSequence(const Event& e) {
+  uint64_t seq = static_cast<uint64_t>(e.t_sec);
+  Event expected = makeEvent(seq);
+  assert(e.type == expected.type);
+  assert(e.frame.t_sec == expected.frame.t_sec);
+  assert(e.frame.ax == expected.frame.ax && e.frame.ay == expected.frame.ay);
+  assert(e.frame.az == expected.frame.az && e.frame.gx == expected.frame.gx);
+  assert(e.frame.gy == expected.frame.gy && e.frame.gz == expected.frame.gz);
+  return seq;
+}
+
+struct StressResult {
+  uint64_t popped = 0;
+  std::atomic<uint64_t> rejected{0};  // Counted by the producer
+};
+
+// One producer thread pushing `count` events against the calling thread
+// popping; checks order and integrity of everything received
+void runStress(EventQueue& queue, uint64_t count, bool retry_rejected, StressResult& result) {
+  std::thread producer([&] {
+    for (uint64_t i = 0; i < count; ++i) {
+      while (!queue.push(makeEvent(i))) {
+        if (!retry_rejected) {
+          ++result.rejected;
+          break;
+        }
+        std::this_thread::yield();
+      }
+    }
+  });
+  
+  bool any = false;
+  uint64_t last = 0;
+  Event e;
+  auto consume = [&] {
+    while (queue.pop(e)) {
+      uint64_t seq = checkedSequence(e);
+      assert(!any || seq > last);
+      any = true;
+      last = seq;
+      ++result.popped;
+    }
+  };
+  // Poll until the producer is done, yielding now and then so a slow
+  // consumer makes the ring overflow
+  while (queue.pushed() + result.rejected < count || queue.size() > 0) {
+    consume();
+    std::this_thread::yield();
+  }
+  producer.join();
+  consume();
+}
+
+} // namespace
+
+TEST(fifo_and_power_of_two_capacity) {
+  EventQueue queue(5);
+  assert(queue.capacity() == 8);
+  assert(queue.size() == 0);
+  
+  Event out;
+  assert(!queue.pop(out));
+  for (uint64_t i = 0; i < 8; ++i) {
+    assert(queue.push(makeEvent(i)));
+  }
+  assert(queue.size() == 8);
+  for (uint64_t i = 0; i < 8; ++i) {
+    assert(queue.pop(out));
+    assert(checkedSequence(out) == i);
+  }
+  assert(!queue.pop(out));
+  assert(queue.dropped() == 0);
+  assert(queue.highWaterMark() == 8);
+  
+  // Indices keep running across many wraps
+  for (uint64_t i = 8; i < 1000; ++i) {
+    assert(queue.push(makeEvent(i)));
+    assert(queue.pop(out) && checkedSequence(out) == i);
+  }
+  assert(queue.highWaterMark() == 8);
+}
+
+TEST(drop_oldest_keeps_newest) {
+  EventQueue queue(4);
+  for (uint64_t i = 0; i < 10; ++i) {
+    assert(queue.push(makeEvent(i)));
+  }
+  assert(queue.size() == 4);
+  assert(queue.dropped() == 6);
+  assert(queue.highWaterMark() == 4);
+  
+  Event out;
+  for (uint64_t i = 6; i < 10; ++i) {
+    assert(queue.pop(out));
+    assert(checkedSequence(out) == i);
+  }
+  assert(!queue.pop(out));
+}
+
+TEST(reject_keeps_oldest) {
+  EventQueue queue(4, EventQueue::OverflowPolicy::Reject);
+  int accepted = 0;
+  for (uint64_t i = 0; i < 10; ++i) {
+    accepted += queue.push(makeEvent(i)) ? 1 : 0;
+  }
+  assert(accepted == 4);
+  assert(queue.dropped() == 6);
+  
+  Event out;
+  for (uint64_t i = 0; i < 4; ++i) {
+    assert(queue.pop(out));
+    assert(checkedSequence(out) == i);
+  }
+  assert(queue.push(makeEvent(10)));
+  assert(queue.pop(out) && checkedSequence(out) == 10);
+}
+
+TEST(stress_drop_oldest) {
+  // Small ring so the producer laps the consumer constantly
+  const uint64_t count = 2000000;
+  EventQueue queue(16);
+  StressResult r;
+  runStress(queue, count, false, r);
+  std::cout << "  popped " << r.popped << ", dropped " << queue.dropped()
+            << ", high water " << queue.highWaterMark() << std::endl;
+  assert(r.popped + queue.dropped() == count);
+  assert(queue.highWaterMark() <= queue.capacity());
+}
+
+TEST(stress_reject) {
+  const uint64_t count = 2000000;
+  EventQueue queue(16, EventQueue::OverflowPolicy::Reject);
+  StressResult r;
+  runStress(queue, count, false, r);
+  std::cout << "  popped " << r.popped << ", rejected " << r.rejected << std::endl;
+  assert(r.rejected == queue.dropped());
+  assert(r.popped + r.rejected == count);
+}
+
+TEST(stress_lossless_with_retry) {
+  // Reject plus a retrying producer delivers every event exactly once
+  const uint64_t count = 1000000;
+  EventQueue queue(64, EventQueue::OverflowPolicy::Reject);
+  StressResult r;
+  runStress(queue, count, true, r);
+  assert(r.popped == count);
+  assert(queue.pushed() == count);
+}
+
+TEST(throughput) {
+  const uint64_t count = 4000000;
+  
+  // Same thread: cost of the operations themselves
+  EventQueue queue(1024);
+  Event out;
+  uint64_t sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < count; i += 256) {
+    for (uint64_t j = 0; j < 256; ++j) {
+      queue.push(makeEvent(i + j));
+    }
+    while (queue.pop(out)) {
+      sum += static_cast<uint64_t>(out.t_sec);
+    }
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  assert(sum == count * (count - 1) / 2);
+  assert(queue.dropped() == 0);
+  std::cout << "  single thread: " << count / seconds / 1e6 << " M events/s" << std::endl;
+  
+  // Producer and consumer threads, lossless
+  EventQueue shared(1024, EventQueue::OverflowPolicy::Reject);
+  start = std::chrono::steady_clock::now();
+  StressResult r;
+  runStress(shared, count, true, r);
+  seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  assert(r.popped == count);
+  std::cout << "  two threads: " << count / seconds / 1e6 << " M events/s ("
+            << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+}
+
+int main() {
+  std::cout << "=== Event Queue Tests ===" << std::endl;
+  
+  RUN_TEST(fifo_and_power_of_two_capacity);
+  RUN_TEST(drop_oldest_keeps_newest);
+  RUN_TEST(reject_keeps_oldest);
+  RUN_TEST(stress_drop_oldest);
+  RUN_TEST(stress_reject);
+  RUN_TEST(stress_lossless_with_retry);
+  RUN_TEST(throughput);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,264 @@
+#include "domain/PhysicsEngine.hpp"
+#include "domain/TrajectoryHash.hpp"
+#include "domain/WindField.hpp"
+#include <iostream>
+#include <cmath>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+// Golden-run corpus: launch conditions and configurations with the hash
+// and summary each produced when recorded. A mismatch means a flight
+// changed - a physics edit, integrator tweak, compiler flag or
+// optimisation (fast-math, SIMD, reordered sums). If the change is
+// intended, re-record with `test_golden --update` and commit the corpus.
+//
+// GOLDEN_TOLERANCE_ONLY=1 checks only the summaries (1 mm / 1 ms), for
+// platforms whose libm rounds sin/cos/exp differently from the recording.
+
+#ifndef GOLDEN_CORPUS_PATH
+#define GOLDEN_CORPUS_PATH "golden/flights.csv"
+#endif
+
+namespace {
+
+struct GoldenCase {
+  std::string name;
+  std::string engine;       // configured | spin_rk4_f | simple_euler_f
+  std::string integrator;   // euler | rk4 | rk45
+  std::string aero;         // simple | spin
+  int ground = 0;
+  int precompute = 0;
+  double speed_mps = 0.0;
+  double angle_deg = 0.0;
+  domain::Vec3 spin;
+  domain::Vec3 wind;
+  double wind_field_mps = 0.0;  // 0: no WindField
+  double altitude_m = -1.0;     // < 0: fixed sea-level air
+  
+  // Recorded
+  uint64_t hash = 0;
+  size_t points = 0;
+  double carry_m = 0.0;
+  double lateral_m = 0.0;
+  double flight_time_s = 0.0;
+  double total_m = 0.0;
+};
+
+struct Outcome {
+  uint64_t hash = 0;
+  size_t points = 0;
+  domain::ShotResult result;
+};
+
+domain::PhysicsConfig configFor(const GoldenCase& c) {
+  domain::PhysicsConfig config;
+  config.integrator = c.integrator == "rk45" ? domain::PhysicsConfig::Integrator::RK45
+                    : c.integrator == "rk4" ? domain::PhysicsConfig::Integrator::RK4
+                    : domain::PhysicsConfig::Integrator::Euler;
+  config.aero_model = c.aero == "spin" ? domain::PhysicsConfig::AeroModel::SpinAware
+                                       : domain::PhysicsConfig::AeroModel::Simple;
+  config.ground_phase = c.ground != 0;
+  config.precompute_flight = c.precompute != 0;
+  config.wind_velocity = c.wind;
+  if (c.altitude_m >= 0.0) {
+    config.use_atmosphere = true;
+    config.atmosphere.altitude_m = c.altitude_m;
+  }
+  return config;
+}
+
+template <typename Engine>
+Outcome fly(const GoldenCase& c) {
+  domain::PhysicsConfig config = configFor(c);
+  std::unique_ptr<domain::WindField> field;
+  Engine physics(config);
+  if (c.wind_field_mps > 0.0) {
+    domain::WindFieldConfig wind;
+    wind.speed_mps = c.wind_field_mps;
+    wind.direction_deg = 60.0;
+    wind.seed = 42;
+    field = std::make_unique<domain::WindField>(wind);
+    physics.setWindField(field.get(), 3.0);
+  }
+  domain::LaunchCondition launch(c.speed_mps, c.angle_deg);
+  launch.initial_spin = c.spin;
+  physics.startShot(launch);
+  while (!physics.isAtRest()) {
+    physics.step(1.0 / 60.0);
+  }
+  Outcome out;
+  out.hash = domain::hashTrajectory(physics.getTrajectory());
+  out.points = physics.getTrajectory().size();
+  out.result = physics.calculateResult();
+  return out;
+}
+
+Outcome run(const GoldenCase& c) {
+  if (c.engine == "spin_rk4_f") return fly<domain::SpinAwareRK4EngineF>(c);
+  if (c.engine == "simple_euler_f") return fly<domain::SimpleEulerEngineF>(c);
+  return fly<domain::PhysicsEngine>(c);
+}
+
+const char* HEADER =
+  "# name,engine,integrator,aero,ground,precompute,speed_mps,angle_deg,spin_x,spin_y,spin_z,"
+  "wind_x,wind_y,wind_field_mps,altitude_m,hash,points,carry_m,lateral_m,flight_time_s,total_m";
+
+std::vector<GoldenCase> loadCorpus(const std::string& path) {
+  std::vector<GoldenCase> cases;
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::vector<std::string> f;
+    std::stringstream ss(line);
+    std::string field;
+    while (std::getline(ss, field, ',')) f.push_back(field);
+    assert(f.size() == 21);
+    GoldenCase c;
+    c.name = f[0];
+    c.engine = f[1];
+    c.integrator = f[2];
+    c.aero = f[3];
+    c.ground = std::stoi(f[4]);
+    c.precompute = std::stoi(f[5]);
+    c.speed_mps = std::stod(f[6]);
+    c.angle_deg = std::stod(f[7]);
+    c.spin = domain::Vec3(std::stod(f[8]), std::stod(f[9]), std::stod(f[10]));
+    c.wind = domain::Vec3(std::stod(f[11]), std::stod(f[12]), 0.0);
+    c.wind_field_mps = std::stod(f[13]);
+    c.altitude_m = std::stod(f[14]);
+    c.hash = std::stoull(f[15], nullptr, 16);
+    c.points = std::stoul(f[16]);
+    c.carry_m = std::stod(f[17]);
+    c.lateral_m = std::stod(f[18]);
+    c.flight_time_s = std::stod(f[19]);
+    c.total_m = std::stod(f[20]);
+    cases.push_back(c);
+  }
+  return cases;
+}
+
+void saveCorpus(const std::string& path, const std::vector<GoldenCase>& cases) {
+  std::ofstream out(path);
+  out << HEADER << "\n";
+  for (const GoldenCase& c : cases) {
+    out << c.name << ',' << c.engine << ',' << c.integrator << ',' << c.aero << ','
+        << c.ground << ',' << c.precompute << ',' << c.speed_mps << ',' << c.angle_deg << ','
+        << c.spin.x << ',' << c.spin.y << ',' << c.spin.z << ','
+        << c.wind.x << ',' << c.wind.y << ',' << c.wind_field_mps << ',' << c.altitude_m << ','
+        << std::hex << std::setw(16) << std::setfill('0') << c.hash << std::dec << std::setfill(' ') << ','
+        << c.points << ',' << std::setprecision(17)
+        << c.carry_m << ',' << c.lateral_m << ',' << c.flight_time_s << ',' << c.total_m
+        << std::setprecision(6) << "\n";
+  }
+}
+
+bool toleranceOnly() {
+  const char* env = std::getenv("GOLDEN_TOLERANCE_ONLY");
+  return env && std::strcmp(env, "0") != 0;
+}
+
+} // namespace
+
+TEST(hash_is_exact_and_chunking_independent) {
+  domain::PhysicsConfig config;
+  config.integrator = domain::PhysicsConfig::Integrator::RK4;
+  domain::PhysicsEngine a(config);
+  domain::PhysicsEngine b(config);
+  a.startShot(domain::LaunchCondition(60.0, 14.0));
+  b.startShot(domain::LaunchCondition(60.0, 14.0));
+  while (!a.isAtRest()) a.step(1.0 / 60.0);
+  while (!b.isAtRest()) b.step(1.0 / 37.0);  // Frame chunking must not matter
+  assert(domain::hashTrajectory(a.getTrajectory()) == domain::hashTrajectory(b.getTrajectory()));
+  
+  // A sub-millimetre change is caught by the exact hash; tolerance mode
+  // accepts it
+  domain::PhysicsEngine c(config);
+  c.startShot(domain::LaunchCondition(60.0 * (1.0 + 1e-7), 14.0));
+  while (!c.isAtRest()) c.step(1.0 / 60.0);
+  domain::TrajectoryDifference diff = domain::compareTrajectories(a.getTrajectory(), c.getTrajectory());
+  std::cout << "  1e-7 launch change: max deviation " << diff.max_position_m << " m" << std::endl;
+  assert(diff.max_position_m > 0.0 && diff.within(1e-3, 1e-3));
+  assert(domain::hashTrajectory(a.getTrajectory()) != domain::hashTrajectory(c.getTrajectory()));
+  
+  // Euler vs RK4 differ beyond any quantum
+  config.integrator = domain::PhysicsConfig::Integrator::Euler;
+  domain::PhysicsEngine d(config);
+  d.startShot(domain::LaunchCondition(60.0, 14.0));
+  while (!d.isAtRest()) d.step(1.0 / 60.0);
+  assert(domain::hashTrajectory(a.getTrajectory(), 0.01) != domain::hashTrajectory(d.getTrajectory(), 0.01));
+  assert(!domain::compareTrajectories(a.getTrajectory(), d.getTrajectory()).within(0.01, 0.01));
+}
+
+TEST(corpus_matches_recorded_hashes) {
+  std::vector<GoldenCase> cases = loadCorpus(GOLDEN_CORPUS_PATH);
+  assert(!cases.empty());
+  
+  const bool tolerant = toleranceOnly();
+  int bit_exact = 0;
+  int failures = 0;
+  for (const GoldenCase& c : cases) {
+    Outcome o = run(c);
+    double dc = std::abs(o.result.carry_m - c.carry_m);
+    double dl = std::abs(o.result.lateral_m - c.lateral_m);
+    double dt = std::abs(o.result.flight_time_s - c.flight_time_s);
+    double dtot = std::abs(o.result.total_m - c.total_m);
+    bool summary_ok = dc < 1e-3 && dl < 1e-3 && dt < 1e-3 && dtot < 1e-3;
+    bool exact = o.hash == c.hash && o.points == c.points;
+    bit_exact += exact ? 1 : 0;
+    if (exact || (tolerant && summary_ok)) {
+      continue;
+    }
+    ++failures;
+    std::cout << "  " << c.name << ": hash " << std::hex << o.hash << " != " << c.hash << std::dec
+              << ", points " << o.points << " / " << c.points
+              << ", carry diff " << dc << " m, time diff " << dt << " s"
+              << (summary_ok ? " (bit drift within tolerance: check compiler flags)" : " (flight changed)")
+              << std::endl;
+  }
+  std::cout << "  " << bit_exact << "/" << cases.size() << " flights bit-exact" << std::endl;
+  assert(failures == 0);
+}
+
+int main(int argc, char** argv) {
+  if (argc > 1 && std::strcmp(argv[1], "--update") == 0) {
+    std::string path = argc > 2 ? argv[2] : GOLDEN_CORPUS_PATH;
+    std::vector<GoldenCase> cases = loadCorpus(path);
+    for (GoldenCase& c : cases) {
+      Outcome o = run(c);
+      c.hash = o.hash;
+      c.points = o.points;
+      c.carry_m = o.result.carry_m;
+      c.lateral_m = o.result.lateral_m;
+      c.flight_time_s = o.result.flight_time_s;
+      c.total_m = o.result.total_m;
+    }
+    saveCorpus(path, cases);
+    std::cout << "Recorded " << cases.size() << " golden flights to " << path << std::endl;
+    return 0;
+  }
+  
+  std::cout << "=== Golden Flight Tests ===" << std::endl;
+  
+  RUN_TEST(hash_is_exact_and_chunking_independent);
+  RUN_TEST(corpus_matches_recorded_hashes);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
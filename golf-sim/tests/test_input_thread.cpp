@@ -0,0 +1,237 @@
+#include "infrastructure/InputThread.hpp"
+#include "infrastructure/MockSensorProvider.hpp"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cassert>
+#include <cstdint>
+#include <thread>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+using infrastructure::Event;
+using infrastructure::EventQueue;
+using infrastructure::InputThread;
+using infrastructure::InputThreadConfig;
+using infrastructure::SensorFrame;
+
+namespace {
+
+// Stands in for an IMU sampling at rate_hz: frames become available as
+// monotonic time passes, numbered in ax so gaps are detectable
+class StreamingProvider : public infrastructure::ISensorProvider {
+public:
+  explicit StreamingProvider(double rate_hz) : rate_hz_(rate_hz), start_(InputThread::monotonicNowSec()) {}
+  
+  bool poll(SensorFrame& out) override {
+    if (stall_every_ > 0 && ++calls_ % stall_every_ == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    }
+    double due = (InputThread::monotonicNowSec() - start_) * rate_hz_;
+    if (static_cast<double>(emitted_) >= due) {
+      return false;
+    }
+    out = SensorFrame(static_cast<double>(emitted_) / rate_hz_, static_cast<float>(emitted_),
+                      0.0f, 9.81f, 0.0f, 0.0f, 0.0f);
+    ++emitted_;
+    return true;
+  }
+  
+  void reset() override {
+    emitted_ = 0;
+    start_ = InputThread::monotonicNowSec();
+  }
+  
+  uint64_t emitted() const { return emitted_; }
+  void stallEvery(uint64_t calls) { stall_every_ = calls; }
+
+private:
+  double rate_hz_;
+  double start_;
+  uint64_t emitted_ = 0;
+  uint64_t calls_ = 0;
+  uint64_t stall_every_ = 0;
+};
+
+} // namespace
+
+TEST(poll_once_stamps_monotonic_time) {
+  infrastructure::MockSensorProvider mock;
+  EventQueue queue(16);
+  InputThread input(mock, queue);
+  
+  assert(input.pollOnce() == 0);
+  double before = InputThread::monotonicNowSec();
+  mock.triggerImpact(40.0, 12.0);
+  assert(input.pollOnce() == 1);
+  double after = InputThread::monotonicNowSec();
+  
+  Event e;
+  assert(queue.pop(e));
+  assert(e.type == Event::Type::Pose);
+  assert(e.t_sec == e.frame.t_sec);
+  assert(e.t_sec >= before && e.t_sec <= after);
+  assert(!queue.pop(e));
+  assert(input.stats().frames == 1);
+}
+
+TEST(restamping_keeps_provider_spacing) {
+  // A 1 kHz stream drained in batches: stamps stay 1 ms apart within a
+  // batch (not all equal to its arrival), and none is later than its
+  // arrival. Between batches the offset may only shrink to a lower latency.
+  StreamingProvider provider(1000.0);
+  EventQueue queue(256);
+  InputThread input(provider, queue);
+  
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  size_t first = input.pollOnce();
+  double after_first = InputThread::monotonicNowSec();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  size_t second = input.pollOnce();
+  double after_second = InputThread::monotonicNowSec();
+  assert(first >= 10 && second >= 5);
+  
+  Event e;
+  assert(queue.pop(e));
+  double previous = e.t_sec;
+  for (size_t i = 1; i < first + second; ++i) {
+    assert(queue.pop(e));
+    double spacing = e.t_sec - previous;
+    if (i == first) {
+      assert(spacing >= 0.0 && spacing <= 0.001 + 1e-9);
+    } else {
+      assert(std::abs(spacing - 0.001) < 1e-9);
+    }
+    assert(e.t_sec <= (i < first ? after_first : after_second));
+    previous = e.t_sec;
+  }
+  
+  // Provider restarted: its time runs again from 0, the stamps move on
+  double last = e.t_sec;
+  provider.reset();
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  assert(input.pollOnce() > 0);
+  while (queue.pop(e)) {
+    assert(e.t_sec >= last && e.t_sec <= InputThread::monotonicNowSec());
+    last = e.t_sec;
+  }
+}
+
+TEST(provider_timestamps_kept_when_asked) {
+  StreamingProvider provider(1000.0);
+  EventQueue queue(64);
+  InputThreadConfig config;
+  config.restamp_frames = false;
+  InputThread input(provider, queue, config);
+  
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  size_t n = input.pollOnce();
+  assert(n >= 5);
+  Event e;
+  for (size_t i = 0; i < n; ++i) {
+    assert(queue.pop(e));
+    assert(e.t_sec == static_cast<double>(i) / 1000.0);
+  }
+}
+
+TEST(thread_delivers_every_frame_through_slow_frames) {
+  // 1 kHz sensor against a consumer that stalls for 40 ms at a time
+  StreamingProvider provider(1000.0);
+  EventQueue queue(4096);
+  InputThreadConfig config;
+  config.poll_rate_hz = 2000.0;
+  InputThread input(provider, queue, config);
+  
+  input.start();
+  assert(input.isRunning());
+  uint64_t received = 0;
+  double last_t = 0.0;
+  Event e;
+  for (int frame = 0; frame < 8; ++frame) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    while (queue.pop(e)) {
+      assert(static_cast<uint64_t>(e.frame.ax) == received);  // No gaps
+      assert(e.t_sec >= last_t);
+      last_t = e.t_sec;
+      ++received;
+    }
+  }
+  input.stop();
+  assert(!input.isRunning());
+  while (queue.pop(e)) {
+    assert(static_cast<uint64_t>(e.frame.ax) == received);
+    ++received;
+  }
+  
+  infrastructure::InputThreadStats s = input.stats();
+  std::cout << "  " << s.frames << " frames at " << s.frame_rate_hz << " Hz, "
+            << s.wakeups << " wake-ups at " << s.poll_rate_hz << " Hz, jitter "
+            << s.mean_jitter_us << " us mean / " << s.max_jitter_us << " us max, "
+            << s.overruns << " overruns" << std::endl;
+  assert(received == provider.emitted());
+  assert(s.frames == received);
+  assert(queue.dropped() == 0);
+  assert(received > 150);                         // ~320 expected
+  assert(s.wakeups > 100 && s.poll_rate_hz > 0.0);  // ~640 expected; loose for loaded machines
+  assert(s.elapsed_sec > 0.3);
+  assert(s.mean_jitter_us >= 0.0 && s.max_jitter_us >= s.mean_jitter_us);
+}
+
+TEST(slow_provider_counts_overruns) {
+  // Every 20th poll takes 3 ms: far past a 0.5 ms period
+  StreamingProvider provider(1000.0);
+  provider.stallEvery(20);
+  EventQueue queue(4096);
+  InputThread input(provider, queue);
+  
+  input.start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  input.stop();
+  
+  infrastructure::InputThreadStats s = input.stats();
+  std::cout << "  " << s.overruns << " overruns, " << s.missed_periods << " missed periods in "
+            << s.wakeups << " wake-ups" << std::endl;
+  assert(s.overruns > 0);
+  assert(s.missed_periods >= s.overruns);
+  assert(s.max_jitter_us >= 0.0);
+  assert(queue.dropped() == 0);
+}
+
+TEST(mock_impact_from_another_thread) {
+  infrastructure::MockSensorProvider mock;
+  EventQueue queue(16);
+  InputThread input(mock, queue);
+  input.start();
+  
+  mock.triggerImpact(50.0, 14.0);
+  Event e;
+  bool got = false;
+  for (int i = 0; i < 200 && !got; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    got = queue.pop(e);
+  }
+  input.stop();
+  assert(got);
+  assert(e.frame.az > 19.0f);  // The mock's impact spike
+  assert(!queue.pop(e));       // One-shot
+}
+
+int main() {
+  std::cout << "=== Input Thread Tests ===" << std::endl;
+  
+  RUN_TEST(poll_once_stamps_monotonic_time);
+  RUN_TEST(restamping_keeps_provider_spacing);
+  RUN_TEST(provider_timestamps_kept_when_asked);
+  RUN_TEST(thread_delivers_every_frame_through_slow_frames);
+  RUN_TEST(slow_provider_counts_overruns);
+  RUN_TEST(mock_impact_from_another_thread);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
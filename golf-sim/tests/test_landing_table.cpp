@@ -0,0 +1,151 @@
+#include "application/LandingTable.hpp"
+#include "infrastructure/FileLandingCacheRepository.hpp"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+namespace {
+
+domain::PhysicsConfig makeConfig() {
+  domain::PhysicsConfig config;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  return config;
+}
+
+// Coarse grid for the cache tests (fast to build)
+application::LandingTableLayout smallLayout() {
+  application::LandingTableLayout layout;
+  layout.power_points = 4;
+  layout.aim_points = 3;
+  layout.wind_points = 3;
+  return layout;
+}
+
+std::string cachePath() {
+  return "test_landing_table.cache";
+}
+
+} // namespace
+
+TEST(landing_table_matches_simulation) {
+  application::ShotParameterService shots;
+  application::LandingTable table(shots, makeConfig());
+  
+  domain::Vec3 wind(1.0, 0.0, 0.0);
+  application::LandingEstimate estimate;
+  assert(!table.lookup(0, 0.7, 0.0, wind, estimate));  // Not built yet
+  
+  auto t0 = std::chrono::steady_clock::now();
+  table.start();
+  table.wait();
+  auto t1 = std::chrono::steady_clock::now();
+  std::cout << "  build: " << std::chrono::duration<double>(t1 - t0).count() << " s" << std::endl;
+  assert(table.isReady());
+  assert(!table.isFromCache());
+  
+  application::LandingTableValidation report = table.validate(100);
+  std::cout << "  max error " << report.max_error_m << " m, mean " << report.mean_error_m << " m" << std::endl;
+  assert(report.samples == 100);
+  assert(report.max_error_m < 0.5);
+  assert(report.mean_error_m < 0.15);
+  
+  // Aim rotates the landing point to the right
+  application::LandingEstimate left, right;
+  assert(table.lookup(0, 0.7, -10.0, wind, left));
+  assert(table.lookup(0, 0.7, 10.0, wind, right));
+  assert(left.x < 0.0 && right.x > 0.0);
+  assert(right.flight_time_s > 3.0);
+}
+
+TEST(landing_table_cache_round_trip) {
+  std::remove(cachePath().c_str());
+  application::ShotParameterService shots;
+  infrastructure::FileLandingCacheRepository cache(cachePath());
+  
+  application::LandingTable built(shots, makeConfig(), &cache, smallLayout());
+  built.start();
+  built.wait();
+  assert(built.isReady() && !built.isFromCache());
+  
+  // Second startup maps the file instead of rebuilding
+  application::LandingTable loaded(shots, makeConfig(), &cache, smallLayout());
+  loaded.start();
+  assert(loaded.isReady());
+  assert(loaded.isFromCache());
+  
+  application::LandingEstimate a, b;
+  built.lookup(2, 0.63, 7.0, domain::Vec3(-2.0, 3.0, 0.0), a);
+  loaded.lookup(2, 0.63, 7.0, domain::Vec3(-2.0, 3.0, 0.0), b);
+  assert(a.x == b.x && a.y == b.y && a.flight_time_s == b.flight_time_s);
+  
+  std::remove(cachePath().c_str());
+}
+
+TEST(landing_table_cache_keyed_by_config) {
+  std::remove(cachePath().c_str());
+  application::ShotParameterService shots;
+  infrastructure::FileLandingCacheRepository cache(cachePath());
+  
+  application::LandingTable first(shots, makeConfig(), &cache, smallLayout());
+  first.start();
+  first.wait();
+  
+  // Wind is a table axis: same key
+  domain::PhysicsConfig windy = makeConfig();
+  windy.wind_velocity = domain::Vec3(4.0, 0.0, 0.0);
+  application::LandingTable same(shots, windy, &cache, smallLayout());
+  assert(same.getKey() == first.getKey());
+  
+  // Different physics or grid: stale cache is ignored and rebuilt
+  domain::PhysicsConfig heavier = makeConfig();
+  heavier.air_density_kgpm3 = 1.0;
+  application::LandingTable other(shots, heavier, &cache, smallLayout());
+  assert(other.getKey() != first.getKey());
+  other.start();
+  other.wait();
+  assert(other.isReady() && !other.isFromCache());
+  
+  application::LandingTableLayout finer = smallLayout();
+  finer.power_points = 5;
+  application::LandingTable regrid(shots, makeConfig(), &cache, finer);
+  assert(regrid.getKey() != first.getKey());
+  
+  // Truncated file is rejected
+  {
+    FILE* file = std::fopen(cachePath().c_str(), "r+b");
+    assert(file);
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fclose(file);
+    assert(truncate(cachePath().c_str(), size - 4) == 0);
+  }
+  application::LandingTable damaged(shots, heavier, &cache, smallLayout());
+  damaged.start();
+  assert(!damaged.isFromCache());
+  damaged.wait();
+  
+  std::remove(cachePath().c_str());
+}
+
+int main() {
+  std::cout << "=== Landing Table Tests ===" << std::endl;
+  
+  RUN_TEST(landing_table_matches_simulation);
+  RUN_TEST(landing_table_cache_round_trip);
+  RUN_TEST(landing_table_cache_keyed_by_config);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
@@ -1,5 +1,7 @@
 #include "domain/PhysicsEngine.hpp"
 #include "domain/BallState.hpp"
+#include "domain/AeroCoefficients.hpp"
+#include "domain/ReferenceFlight.hpp"
 #include <iostream>
 #include <cmath>
 #include <cassert>
@@ -137,7 +139,7 @@ TEST(physics_trajectory_points) {
   assert(traj.size() > 100);
   
   // First point should be at origin
-  const domain::BallState& first = traj.getPoints()[0];
+  const domain::BallState& first = traj.getPoint(0);
   assert(std::abs(first.pos.x) < 0.01);
   assert(std::abs(first.pos.y) < 0.01);
   assert(std::abs(first.pos.z) < 0.01);
@@ -147,6 +149,829 @@ TEST(physics_trajectory_points) {
   assert(std::abs(last.pos.z) < 0.01);
 }
 
+TEST(physics_precompute_matches_stepped) {
+  // Precomputed flight must land exactly where the real-time path lands
+  domain::PhysicsConfig config;
+  config.drag_coefficient = 0.02;
+  config.wind_velocity = domain::Vec3(1.0, 0.0, 0.0);
+  
+  domain::PhysicsConfig config_pre = config;
+  config_pre.precompute_flight = true;
+  
+  domain::PhysicsEngine stepped(config);
+  domain::PhysicsEngine precomputed(config_pre);
+  
+  domain::LaunchCondition launch;
+  launch.launch_speed_mps = 55.0;
+  launch.launch_angle_deg = 15.0;
+  
+  stepped.startShot(launch);
+  precomputed.startShot(launch);
+  
+  // Result is known at impact, before any playback
+  assert(precomputed.isResultAvailable());
+  assert(!precomputed.hasLanded());
+  assert(!stepped.isResultAvailable());
+  
+  while (!stepped.hasLanded()) {
+    stepped.step(1.0 / 60.0);
+  }
+  
+  domain::ShotResult expected = stepped.calculateResult();
+  domain::ShotResult early = precomputed.calculateResult();
+  assert(early.carry_m == expected.carry_m);
+  assert(early.flight_time_s == expected.flight_time_s);
+  assert(precomputed.getTrajectory().size() == stepped.getTrajectory().size());
+}
+
+TEST(physics_precompute_playback) {
+  // step() only moves a playback cursor over the stored trajectory
+  domain::PhysicsConfig config;
+  config.precompute_flight = true;
+  
+  domain::PhysicsEngine physics(config);
+  
+  domain::LaunchCondition launch;
+  launch.launch_speed_mps = 30.0;
+  launch.launch_angle_deg = 20.0;
+  
+  physics.startShot(launch);
+  size_t points = physics.getTrajectory().size();
+  double flight_time = physics.calculateResult().flight_time_s;
+  
+  // Ball starts at the tee
+  assert(physics.isInFlight());
+  assert(std::abs(physics.getCurrentState().pos.y) < 1e-9);
+  
+  // Odd frame time that does not line up with dt_fixed_sec
+  physics.step(0.0123);
+  assert(std::abs(physics.getPlaybackTime() - 0.0123) < 1e-12);
+  assert(std::abs(physics.getCurrentState().t_sec - 0.0123) < 1e-12);
+  assert(physics.getCurrentState().pos.y > 0.0);
+  assert(physics.getCurrentState().pos.z > 0.0);
+  
+  while (!physics.hasLanded()) {
+    physics.step(1.0 / 60.0);
+  }
+  
+  // Playback never re-integrates
+  assert(physics.getTrajectory().size() == points);
+  assert(physics.getCurrentState().t_sec == flight_time);
+  assert(physics.getCurrentState().pos.z == 0.0);
+}
+
+TEST(trajectory_sample_interpolates) {
+  domain::Trajectory traj;
+  traj.addPoint(domain::BallState(0.0, domain::Vec3(0.0, 0.0, 0.0), domain::Vec3(0.0, 10.0, 0.0)));
+  traj.addPoint(domain::BallState(1.0, domain::Vec3(2.0, 10.0, 4.0), domain::Vec3(0.0, 20.0, 0.0)));
+  
+  domain::BallState mid = traj.sampleAt(0.25);
+  assert(std::abs(mid.t_sec - 0.25) < 1e-12);
+  assert(std::abs(mid.pos.x - 0.5) < 1e-12);
+  assert(std::abs(mid.pos.y - 2.5) < 1e-12);
+  assert(std::abs(mid.pos.z - 1.0) < 1e-12);
+  assert(std::abs(mid.vel.y - 12.5) < 1e-12);
+  
+  // Clamped outside the recorded range
+  assert(traj.sampleAt(-1.0).pos.y == 0.0);
+  assert(traj.sampleAt(5.0).pos.y == 10.0);
+}
+
+TEST(trajectory_bounded_keeps_apex_and_landing) {
+  // A small point budget must decimate but keep the exact apex and landing
+  domain::PhysicsConfig config_full;
+  config_full.max_trajectory_points = 100000;
+  domain::PhysicsConfig config_small = config_full;
+  config_small.max_trajectory_points = 64;
+  
+  domain::PhysicsEngine full(config_full);
+  domain::PhysicsEngine small(config_small);
+  
+  domain::LaunchCondition launch;
+  launch.launch_speed_mps = 68.0;
+  launch.launch_angle_deg = 30.0;
+  
+  full.startShot(launch);
+  small.startShot(launch);
+  while (!full.hasLanded()) {
+    full.step(1.0 / 60.0);
+  }
+  while (!small.hasLanded()) {
+    small.step(1.0 / 60.0);
+  }
+  
+  const domain::Trajectory& traj_full = full.getTrajectory();
+  const domain::Trajectory& traj_small = small.getTrajectory();
+  assert(traj_full.size() > 64);
+  assert(traj_small.size() <= 64);
+  assert(traj_small.capacity() == 64);
+  assert(traj_small.getStride() > 1);
+  
+  // Apex and landing samples are bit-identical to the undecimated run
+  domain::BallState apex_full = traj_full.getPoint(traj_full.getApexIndex());
+  domain::BallState apex_small = traj_small.getPoint(traj_small.getApexIndex());
+  assert(apex_small.pos.z == apex_full.pos.z);
+  assert(apex_small.t_sec == apex_full.t_sec);
+  
+  domain::BallState last_full = traj_full.getLastPoint();
+  domain::BallState last_small = traj_small.getLastPoint();
+  assert(last_small.pos.y == last_full.pos.y);
+  assert(last_small.t_sec == last_full.t_sec);
+  assert(!last_small.in_flight);
+  
+  // Points stay in time order after decimation
+  for (size_t i = 1; i < traj_small.size(); ++i) {
+    assert(traj_small.times()[i] >= traj_small.times()[i - 1]);
+  }
+  
+  // Results do not depend on the point budget
+  assert(full.calculateResult().carry_m == small.calculateResult().carry_m);
+}
+
+TEST(trajectory_storage_reused) {
+  domain::Trajectory traj(16);
+  const float* storage = traj.times();
+  
+  for (int shot = 0; shot < 3; ++shot) {
+    traj.clear();
+    for (int i = 0; i < 100; ++i) {
+      traj.addPoint(domain::BallState(i * 0.01, domain::Vec3(0.0, i, 1.0), domain::Vec3()));
+    }
+    assert(traj.size() <= 16);
+    assert(traj.getLastPoint().pos.y == 99.0);
+  }
+  
+  // No reallocation across shots
+  assert(traj.times() == storage);
+  assert(traj.capacity() == 16);
+}
+
+TEST(trajectory_long_climb_stays_bounded) {
+  // Every new point of a climb is the apex so far. Only the highest
+  // provisional point may stay; keeping them all decimated on every point
+  // and doubled the stride until it overflowed.
+  domain::Trajectory traj(domain::Trajectory::MIN_CAPACITY);
+  for (int i = 0; i < 1000; ++i) {
+    traj.addPoint(domain::BallState(i * 0.01, domain::Vec3(0.0, i, i), domain::Vec3()));
+    assert(traj.size() <= traj.capacity());
+    assert(traj.getApexIndex() == traj.size() - 1);
+  }
+  assert(traj.getStride() >= 64 && traj.getStride() <= 1000);
+  assert(traj.getLastPoint().pos.z == 999.0);
+  for (size_t i = 1; i < traj.size(); ++i) {
+    assert(traj.times()[i] > traj.times()[i - 1]);
+  }
+}
+
+namespace {
+
+domain::ShotResult simulate(const domain::PhysicsConfig& config,
+                            const domain::LaunchCondition& launch,
+                            double frame_dt, long* evaluations = nullptr) {
+  domain::PhysicsEngine physics(config);
+  physics.startShot(launch);
+  while (!physics.hasLanded()) {
+    physics.step(frame_dt);
+  }
+  if (evaluations) {
+    *evaluations = physics.getForceEvaluationCount();
+  }
+  return physics.calculateResult();
+}
+
+} // namespace
+
+TEST(physics_rk45_matches_analytic_range) {
+  // No drag: range = v^2 / g at 45 degrees
+  domain::PhysicsConfig config;
+  config.drag_coefficient = 0.0;
+  
+  domain::LaunchCondition launch;
+  launch.launch_speed_mps = 30.0;
+  launch.launch_angle_deg = 45.0;
+  double expected = 30.0 * 30.0 / config.gravity;
+  
+  domain::PhysicsConfig euler = config;
+  domain::PhysicsConfig rk45 = config;
+  rk45.integrator = domain::PhysicsConfig::Integrator::RK45;
+  
+  long euler_evals = 0;
+  long rk45_evals = 0;
+  double euler_err = std::abs(simulate(euler, launch, 1.0 / 60.0, &euler_evals).carry_m - expected);
+  double rk45_err = std::abs(simulate(rk45, launch, 1.0 / 60.0, &rk45_evals).carry_m - expected);
+  
+  assert(rk45_err < 1e-6);
+  assert(rk45_err < euler_err);
+  assert(rk45_evals * 5 < euler_evals);
+}
+
+TEST(physics_rk45_fewer_evaluations_with_drag) {
+  domain::PhysicsConfig config;
+  config.drag_coefficient = 0.02;
+  config.wind_velocity = domain::Vec3(2.0, -3.0, 0.0);
+  
+  domain::LaunchCondition launch;
+  launch.launch_speed_mps = 68.0;
+  launch.launch_angle_deg = 12.0;
+  
+  // Reference: tight-tolerance adaptive run
+  domain::PhysicsConfig reference = config;
+  reference.integrator = domain::PhysicsConfig::Integrator::RK45;
+  reference.rk45_rel_tol = 1e-12;
+  reference.rk45_abs_tol = 1e-12;
+  double expected = simulate(reference, launch, 1.0 / 60.0).carry_m;
+  
+  domain::PhysicsConfig rk4 = config;
+  rk4.integrator = domain::PhysicsConfig::Integrator::RK4;
+  domain::PhysicsConfig rk45 = config;
+  rk45.integrator = domain::PhysicsConfig::Integrator::RK45;
+  
+  long euler_evals = 0;
+  long rk4_evals = 0;
+  long rk45_evals = 0;
+  double euler_err = std::abs(simulate(config, launch, 1.0 / 60.0, &euler_evals).carry_m - expected);
+  double rk4_err = std::abs(simulate(rk4, launch, 1.0 / 60.0, &rk4_evals).carry_m - expected);
+  double rk45_err = std::abs(simulate(rk45, launch, 1.0 / 60.0, &rk45_evals).carry_m - expected);
+  
+  std::cout << "  carry error (m): euler " << euler_err << ", rk4 " << rk4_err
+            << ", rk45 " << rk45_err << std::endl;
+  std::cout << "  evaluations: euler " << euler_evals << ", rk4 " << rk4_evals
+            << ", rk45 " << rk45_evals << std::endl;
+  
+  assert(rk45_err <= euler_err);
+  assert(rk45_err < 1e-3);
+  assert(rk45_evals < euler_evals);
+}
+
+TEST(physics_rk45_deterministic_across_frame_rates) {
+  domain::PhysicsConfig config;
+  config.integrator = domain::PhysicsConfig::Integrator::RK45;
+  config.wind_velocity = domain::Vec3(1.0, 0.0, 0.0);
+  
+  domain::LaunchCondition launch;
+  launch.launch_speed_mps = 55.0;
+  launch.launch_angle_deg = 15.0;
+  
+  domain::ShotResult a = simulate(config, launch, 1.0 / 60.0);
+  domain::ShotResult b = simulate(config, launch, 1.0 / 37.0);
+  domain::PhysicsConfig pre = config;
+  pre.precompute_flight = true;
+  domain::ShotResult c = simulate(pre, launch, 1.0 / 60.0);
+  
+  // Step sizes depend only on the state, never on frame timing
+  assert(a.carry_m == b.carry_m);
+  assert(a.flight_time_s == b.flight_time_s);
+  assert(a.carry_m == c.carry_m);
+}
+
+TEST(physics_rk45_dense_output_samples) {
+  // Adaptive steps are large, but the trajectory is sampled every dt_fixed_sec
+  domain::PhysicsConfig config;
+  config.integrator = domain::PhysicsConfig::Integrator::RK45;
+  config.precompute_flight = true;
+  
+  domain::PhysicsEngine physics(config);
+  domain::LaunchCondition launch;
+  launch.launch_speed_mps = 40.0;
+  launch.launch_angle_deg = 20.0;
+  physics.startShot(launch);
+  
+  const domain::Trajectory& traj = physics.getTrajectory();
+  assert(physics.getForceEvaluationCount() < static_cast<long>(traj.size()));
+  for (size_t i = 1; i + 1 < traj.size(); ++i) {
+    double spacing = traj.times()[i] - traj.times()[i - 1];
+    assert(std::abs(spacing - config.dt_fixed_sec) < 1e-5);
+  }
+  assert(traj.getLastPoint().pos.z == 0.0);
+}
+
+TEST(physics_touchdown_located_inside_step) {
+  // RK4 is exact for constant acceleration and the Hermite touchdown is too,
+  // so even a very coarse step lands exactly on the analytic point
+  domain::PhysicsConfig config;
+  config.drag_coefficient = 0.0;
+  config.integrator = domain::PhysicsConfig::Integrator::RK4;
+  config.dt_fixed_sec = 1.0 / 10.0;
+  
+  domain::LaunchCondition launch;
+  launch.launch_speed_mps = 30.0;
+  launch.launch_angle_deg = 35.0;
+  double angle = 35.0 * M_PI / 180.0;
+  double vy = 30.0 * std::cos(angle);
+  double vz = 30.0 * std::sin(angle);
+  double flight_time = 2.0 * vz / config.gravity;
+  
+  domain::PhysicsEngine physics(config);
+  physics.startShot(launch);
+  while (!physics.hasLanded()) {
+    physics.step(1.0 / 60.0);
+  }
+  
+  domain::ShotResult result = physics.calculateResult();
+  assert(std::abs(result.flight_time_s - flight_time) < 1e-9);
+  assert(std::abs(result.carry_m - vy * flight_time) < 1e-8);
+  assert(result.landing_position.z == 0.0);
+  
+  // Impact velocity is reported, not zeroed
+  assert(std::abs(result.landing_velocity.y - vy) < 1e-8);
+  assert(std::abs(result.landing_velocity.z + vz) < 1e-8);
+  assert(physics.getLandingState().t_sec == result.flight_time_s);
+  
+  // The resting ball itself is stopped
+  assert(physics.getCurrentState().vel.length() == 0.0);
+}
+
+TEST(physics_carry_unbiased_by_step_size) {
+  // Coarse and fine steps agree once touchdown is interpolated
+  domain::PhysicsConfig fine;
+  fine.drag_coefficient = 0.02;
+  fine.wind_velocity = domain::Vec3(1.0, 2.0, 0.0);
+  fine.integrator = domain::PhysicsConfig::Integrator::RK4;
+  fine.dt_fixed_sec = 1.0 / 960.0;
+  domain::PhysicsConfig coarse = fine;
+  coarse.dt_fixed_sec = 1.0 / 30.0;
+  
+  domain::LaunchCondition launch;
+  launch.launch_speed_mps = 55.0;
+  launch.launch_angle_deg = 15.0;
+  
+  domain::ShotResult a = simulate(fine, launch, 1.0 / 60.0);
+  domain::ShotResult b = simulate(coarse, launch, 1.0 / 60.0);
+  
+  // Snapping to step ends would be off by up to ~0.8 m at 30 Hz
+  assert(std::abs(a.carry_m - b.carry_m) < 0.01);
+  assert(std::abs(a.flight_time_s - b.flight_time_s) < 1e-3);
+  
+  // Trajectory times stay ordered through the landing keyframe
+  domain::PhysicsEngine physics(coarse);
+  physics.startShot(launch);
+  while (!physics.hasLanded()) {
+    physics.step(1.0 / 60.0);
+  }
+  const domain::Trajectory& traj = physics.getTrajectory();
+  for (size_t i = 1; i < traj.size(); ++i) {
+    assert(traj.times()[i] > traj.times()[i - 1]);
+  }
+}
+
+TEST(aero_table_interpolates) {
+  // Grid points are returned exactly, midpoints are bilinear blends
+  domain::AeroCoefficients a = domain::lookupAeroCoefficients(160000.0, 0.10);
+  domain::AeroCoefficients b = domain::lookupAeroCoefficients(176000.0, 0.15);
+  domain::AeroCoefficients mid = domain::lookupAeroCoefficients(168000.0, 0.125);
+  domain::AeroCoefficients a2 = domain::lookupAeroCoefficients(176000.0, 0.10);
+  domain::AeroCoefficients b2 = domain::lookupAeroCoefficients(160000.0, 0.15);
+  double expected = 0.25 * (a.lift + b.lift + a2.lift + b2.lift);
+  assert(std::abs(mid.lift - expected) < 1e-6);
+  
+  // Drag crisis: Cd drops across the transition; no lift without spin
+  assert(domain::lookupAeroCoefficients(20000.0, 0.0).drag > 0.45);
+  assert(domain::lookupAeroCoefficients(150000.0, 0.0).drag < 0.25);
+  assert(domain::lookupAeroCoefficients(150000.0, 0.0).lift == 0.0);
+  
+  // Lift grows with spin ratio; out-of-range inputs clamp
+  assert(domain::lookupAeroCoefficients(150000.0, 0.2).lift >
+         domain::lookupAeroCoefficients(150000.0, 0.1).lift);
+  domain::AeroCoefficients edge = domain::lookupAeroCoefficients(240000.0, 0.5);
+  domain::AeroCoefficients clamped = domain::lookupAeroCoefficients(1e7, 3.0);
+  assert(edge.drag == clamped.drag && edge.lift == clamped.lift);
+}
+
+TEST(physics_backspin_lifts_ball) {
+  domain::PhysicsConfig config;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  config.integrator = domain::PhysicsConfig::Integrator::RK4;
+  
+  domain::LaunchCondition launch(68.0, 12.0);
+  domain::ShotResult no_spin = simulate(config, launch, 1.0 / 60.0);
+  
+  launch.initial_spin = domain::Vec3(2500.0, 0.0, 0.0);  // Backspin for +y flight
+  domain::ShotResult backspin = simulate(config, launch, 1.0 / 60.0);
+  
+  // Magnus lift keeps the ball up longer and carries it further
+  assert(backspin.flight_time_s > no_spin.flight_time_s + 1.0);
+  assert(backspin.carry_m > no_spin.carry_m + 20.0);
+  assert(std::abs(backspin.lateral_m) < 1e-9);
+}
+
+TEST(physics_side_spin_curves) {
+  domain::PhysicsConfig config;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  config.integrator = domain::PhysicsConfig::Integrator::RK4;
+  
+  domain::LaunchCondition launch(55.0, 15.0);
+  double tilt = 15.0 * M_PI / 180.0;
+  
+  // Slice: spin axis tilted right (negative z component) curves to +x
+  launch.initial_spin = domain::Vec3(3500.0 * std::cos(tilt), 0.0, -3500.0 * std::sin(tilt));
+  domain::ShotResult slice = simulate(config, launch, 1.0 / 60.0);
+  
+  launch.initial_spin.z = -launch.initial_spin.z;
+  domain::ShotResult hook = simulate(config, launch, 1.0 / 60.0);
+  
+  assert(slice.lateral_m > 5.0);
+  assert(hook.lateral_m < -5.0);
+  assert(std::abs(slice.lateral_m + hook.lateral_m) < 1e-6);
+}
+
+TEST(physics_spin_decays) {
+  domain::PhysicsConfig config;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  config.integrator = domain::PhysicsConfig::Integrator::RK4;
+  config.spin_decay_time_sec = 20.0;
+  
+  domain::PhysicsEngine physics(config);
+  domain::LaunchCondition launch(60.0, 14.0);
+  launch.initial_spin = domain::Vec3(3000.0, 0.0, 0.0);
+  physics.startShot(launch);
+  while (!physics.hasLanded()) {
+    physics.step(1.0 / 60.0);
+  }
+  
+  // omega(t) = omega0 * exp(-t / tau)
+  const domain::BallState& landing = physics.getLandingState();
+  double expected = 3000.0 * std::exp(-landing.t_sec / 20.0);
+  assert(std::abs(landing.spin.x - expected) < 1e-3);
+  
+  // Simple model leaves spin untouched
+  config.aero_model = domain::PhysicsConfig::AeroModel::Simple;
+  domain::PhysicsEngine simple(config);
+  simple.startShot(launch);
+  while (!simple.hasLanded()) {
+    simple.step(1.0 / 60.0);
+  }
+  assert(simple.getLandingState().spin.x == 3000.0);
+}
+
+namespace {
+
+template <typename Engine>
+Engine& runToRest(Engine& physics, const domain::LaunchCondition& launch) {
+  physics.startShot(launch);
+  while (!physics.isAtRest()) {
+    physics.step(1.0 / 60.0);
+  }
+  return physics;
+}
+
+} // namespace
+
+TEST(ground_roll_extends_total) {
+  domain::PhysicsConfig config;
+  config.ground_phase = true;
+  domain::PhysicsEngine physics(config);
+  runToRest(physics, domain::LaunchCondition(50.0, 14.0));
+  
+  domain::ShotResult result = physics.calculateResult();
+  assert(physics.hasLanded());
+  assert(result.roll_m > 1.0);
+  assert(std::abs(result.total_m - (result.carry_m + result.roll_m)) < 1e-9);
+  assert(result.rest_position.y > result.landing_position.y);
+  assert(physics.getCurrentState().vel.length() == 0.0);
+  assert(physics.getCurrentState().pos.z == 0.0);
+  
+  // Without a ground phase the ball stops where it lands
+  domain::PhysicsEngine flight_only{domain::PhysicsConfig()};
+  runToRest(flight_only, domain::LaunchCondition(50.0, 14.0));
+  domain::ShotResult carry_only = flight_only.calculateResult();
+  assert(carry_only.roll_m == 0.0);
+  assert(carry_only.total_m == carry_only.carry_m);
+  assert(carry_only.carry_m == result.carry_m);
+}
+
+TEST(ground_backspin_checks_roll) {
+  // Simple aero: spin only matters on the ground
+  domain::PhysicsConfig config;
+  config.ground_phase = true;
+  domain::LaunchCondition launch(45.0, 20.0);
+  
+  domain::PhysicsEngine no_spin(config);
+  runToRest(no_spin, launch);
+  
+  launch.initial_spin = domain::Vec3(6000.0, 0.0, 0.0);
+  domain::PhysicsEngine backspin(config);
+  runToRest(backspin, launch);
+  
+  domain::ShotResult a = no_spin.calculateResult();
+  domain::ShotResult b = backspin.calculateResult();
+  assert(a.carry_m == b.carry_m);
+  assert(b.roll_m < a.roll_m);
+}
+
+TEST(ground_precompute_matches_stepped) {
+  domain::PhysicsConfig config;
+  config.ground_phase = true;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  domain::LaunchCondition launch(60.0, 13.0);
+  launch.initial_spin = domain::Vec3(3000.0, 0.0, -400.0);
+  
+  domain::PhysicsEngine stepped(config);
+  runToRest(stepped, launch);
+  
+  config.precompute_flight = true;
+  domain::PhysicsEngine precomputed(config);
+  precomputed.startShot(launch);
+  domain::ShotResult early = precomputed.calculateResult();
+  assert(!precomputed.isAtRest());
+  
+  domain::ShotResult expected = stepped.calculateResult();
+  assert(early.total_m == expected.total_m);
+  assert(early.rest_position.x == expected.rest_position.x);
+  assert(early.rest_position.y == expected.rest_position.y);
+  
+  // Playback keeps going through the roll, then stops
+  while (!precomputed.hasLanded()) {
+    precomputed.step(1.0 / 60.0);
+  }
+  assert(!precomputed.isAtRest());
+  while (!precomputed.isAtRest()) {
+    precomputed.step(1.0 / 60.0);
+  }
+  assert(precomputed.getCurrentState().pos.y == expected.rest_position.y);
+}
+
+TEST(ground_rest_is_free) {
+  domain::PhysicsConfig config;
+  config.ground_phase = true;
+  domain::PhysicsEngine physics(config);
+  runToRest(physics, domain::LaunchCondition(40.0, 16.0));
+  
+  size_t points = physics.getTrajectory().size();
+  long evaluations = physics.getForceEvaluationCount();
+  domain::BallState rest = physics.getCurrentState();
+  for (int i = 0; i < 600; ++i) {
+    physics.step(1.0 / 60.0);
+  }
+  assert(physics.getTrajectory().size() == points);
+  assert(physics.getForceEvaluationCount() == evaluations);
+  assert(physics.getCurrentState().t_sec == rest.t_sec);
+  assert(physics.getCurrentState().pos.y == rest.pos.y);
+}
+
+TEST(policy_engine_matches_configured) {
+  // Fixed policies select the same code paths as the runtime fields, so
+  // results are bit-identical to the configured reference
+  domain::PhysicsConfig config;
+  config.ground_phase = true;
+  domain::LaunchCondition launch(62.0, 13.0);
+  launch.initial_spin = domain::Vec3(3200.0, 0.0, -500.0);
+  
+  domain::SimpleEulerEngine simple(config);
+  domain::PhysicsEngine simple_ref(config);
+  runToRest(simple, launch);
+  runToRest(simple_ref, launch);
+  
+  // The policies override whatever the config says
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  config.integrator = domain::PhysicsConfig::Integrator::RK4;
+  domain::PhysicsEngine spin_ref(config);
+  config.aero_model = domain::PhysicsConfig::AeroModel::Simple;
+  config.integrator = domain::PhysicsConfig::Integrator::RK45;
+  domain::SpinAwareRK4Engine spin(config);
+  runToRest(spin, launch);
+  runToRest(spin_ref, launch);
+  
+  config.integrator = domain::PhysicsConfig::Integrator::RK45;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  domain::PhysicsEngine adaptive_ref(config);
+  config.integrator = domain::PhysicsConfig::Integrator::Euler;
+  config.aero_model = domain::PhysicsConfig::AeroModel::Simple;
+  domain::SpinAwareRK45Engine adaptive(config);
+  runToRest(adaptive, launch);
+  runToRest(adaptive_ref, launch);
+  
+  domain::ShotResult pairs[3][2] = {
+    {simple.calculateResult(), simple_ref.calculateResult()},
+    {spin.calculateResult(), spin_ref.calculateResult()},
+    {adaptive.calculateResult(), adaptive_ref.calculateResult()},
+  };
+  for (const auto& pair : pairs) {
+    assert(pair[0].carry_m == pair[1].carry_m);
+    assert(pair[0].total_m == pair[1].total_m);
+    assert(pair[0].lateral_m == pair[1].lateral_m);
+    assert(pair[0].flight_time_s == pair[1].flight_time_s);
+  }
+  assert(spin.getForceEvaluationCount() == spin_ref.getForceEvaluationCount());
+  assert(spin.getTrajectory().size() == spin_ref.getTrajectory().size());
+  assert(adaptive.getForceEvaluationCount() == adaptive_ref.getForceEvaluationCount());
+  assert(adaptive.getForceEvaluationCount() < spin.getForceEvaluationCount());  // Adaptive steps
+  assert(pairs[1][0].lateral_m > 1.0);  // Magnus active
+  assert(pairs[2][0].lateral_m > 1.0);
+}
+
+TEST(float_engine_tracks_double) {
+  domain::PhysicsConfig config;
+  config.ground_phase = true;
+  domain::LaunchCondition launch(70.0, 11.0);
+  launch.initial_spin = domain::Vec3(2700.0, 0.0, 300.0);
+  
+  domain::SpinAwareRK4Engine reference(config);
+  domain::SpinAwareRK4EngineF single(config);
+  runToRest(reference, launch);
+  runToRest(single, launch);
+  
+  domain::ShotResult a = reference.calculateResult();
+  domain::ShotResult b = single.calculateResult();
+  std::cout << "  carry " << a.carry_m << " m, float error " << std::abs(a.carry_m - b.carry_m)
+            << " m" << std::endl;
+  assert(std::abs(a.carry_m - b.carry_m) < 0.01);
+  assert(std::abs(a.lateral_m - b.lateral_m) < 0.01);
+  assert(std::abs(a.total_m - b.total_m) < 0.05);
+  assert(std::abs(a.flight_time_s - b.flight_time_s) < 1e-3);
+  
+  domain::SimpleEulerEngine simple(config);
+  domain::SimpleEulerEngineF simple_single(config);
+  runToRest(simple, launch);
+  runToRest(simple_single, launch);
+  assert(std::abs(simple.calculateResult().carry_m - simple_single.calculateResult().carry_m) < 0.01);
+}
+
+// Evaluated by the compiler: a physics regression fails the build
+constexpr domain::ReferenceFlight COMPILE_TIME_DRIVE = [] {
+  domain::PhysicsConfig config;
+  config.dt_fixed_sec = 1.0 / 60.0;
+  return domain::simulateReferenceFlight(config, domain::LaunchCondition(68.0, 12.0));
+}();
+static_assert(COMPILE_TIME_DRIVE.carry_m > 55.0 && COMPILE_TIME_DRIVE.carry_m < 75.0,
+              "reference drive carry out of range");
+static_assert(COMPILE_TIME_DRIVE.apex_m > 4.0 && COMPILE_TIME_DRIVE.flight_time_s > 1.5,
+              "reference drive trajectory out of range");
+static_assert(domain::Vec3(3.0, 4.0, 12.0).length() == 13.0, "constexpr sqrt");
+
+TEST(reference_flight_matches_engine) {
+  // Same RK4 arithmetic and std:: math at runtime: identical results
+  domain::PhysicsConfig config;
+  config.integrator = domain::PhysicsConfig::Integrator::RK4;
+  config.wind_velocity = domain::Vec3(1.5, -2.0, 0.0);
+  domain::LaunchCondition launch(60.0, 14.0);
+  launch.initial_spin = domain::Vec3(3000.0, 0.0, -600.0);
+  
+  for (auto model : {domain::PhysicsConfig::AeroModel::Simple, domain::PhysicsConfig::AeroModel::SpinAware}) {
+    config.aero_model = model;
+    domain::ShotResult result = simulate(config, launch, 1.0 / 60.0);
+    domain::ReferenceFlight reference = domain::simulateReferenceFlight(config, launch);
+    assert(reference.carry_m == result.carry_m);
+    assert(reference.lateral_m == result.lateral_m);
+    assert(reference.flight_time_s == result.flight_time_s);
+  }
+  
+  // The constant-evaluated flight agrees with its runtime twin to rounding
+  domain::PhysicsConfig coarse;
+  coarse.dt_fixed_sec = 1.0 / 60.0;
+  domain::ReferenceFlight runtime = domain::simulateReferenceFlight(coarse, domain::LaunchCondition(68.0, 12.0));
+  assert(std::abs(runtime.carry_m - COMPILE_TIME_DRIVE.carry_m) < 1e-9);
+  assert(std::abs(runtime.flight_time_s - COMPILE_TIME_DRIVE.flight_time_s) < 1e-9);
+}
+
+// ISA sea level standard day, evaluated by the compiler
+static_assert(domain::Atmosphere().density() > 1.2249 && domain::Atmosphere().density() < 1.2251,
+              "ISA sea-level density");
+
+TEST(atmosphere_density) {
+  domain::Atmosphere sea_level;
+  assert(std::abs(sea_level.density() - 1.225) < 1e-3);
+  assert(std::abs(sea_level.kinematicViscosity() - 1.46e-5) < 0.02e-5);
+  
+  // ISA at 1600 m (Denver): 83.5 kPa, 4.6 C, 1.048 kg/m^3
+  domain::Atmosphere mile_high;
+  mile_high.altitude_m = 1600.0;
+  mile_high.temperature_c = 4.6;
+  assert(std::abs(mile_high.pressurePa() - 83500.0) < 150.0);
+  assert(std::abs(mile_high.density() - 1.048) < 3e-3);
+  
+  // Heat and humidity both thin the air
+  domain::Atmosphere hot = sea_level;
+  hot.temperature_c = 35.0;
+  domain::Atmosphere humid = hot;
+  humid.relative_humidity = 0.9;
+  assert(hot.density() < sea_level.density());
+  assert(humid.density() < hot.density() && humid.density() > 0.97 * hot.density());
+}
+
+TEST(atmosphere_changes_carry) {
+  domain::LaunchCondition drive(70.0, 12.0);
+  drive.initial_spin = domain::Vec3(2800.0, 0.0, 0.0);
+  
+  for (auto model : {domain::PhysicsConfig::AeroModel::Simple, domain::PhysicsConfig::AeroModel::SpinAware}) {
+    domain::PhysicsConfig fixed;
+    fixed.aero_model = model;
+    fixed.integrator = domain::PhysicsConfig::Integrator::RK4;
+    
+    // The default atmosphere reproduces the fixed sea-level constants
+    domain::PhysicsConfig sea_level = fixed;
+    sea_level.use_atmosphere = true;
+    sea_level.air_kinematic_viscosity = sea_level.atmosphere.kinematicViscosity();
+    fixed.air_kinematic_viscosity = sea_level.air_kinematic_viscosity;
+    double base = simulate(fixed, drive, 1.0 / 60.0).carry_m;
+    assert(std::abs(simulate(sea_level, drive, 1.0 / 60.0).carry_m - base) < 0.01);
+    
+    domain::PhysicsConfig denver = sea_level;
+    denver.atmosphere.altitude_m = 1600.0;
+    double high = simulate(denver, drive, 1.0 / 60.0).carry_m;
+    
+    domain::PhysicsConfig hot = sea_level;
+    hot.atmosphere.temperature_c = 35.0;
+    double warm = simulate(hot, drive, 1.0 / 60.0).carry_m;
+    
+    std::cout << "  carry sea level " << base << " m, 1600 m " << high << " m, 35 C " << warm << " m" << std::endl;
+    assert(high > base * 1.03 && high < base * 1.15);
+    assert(warm > base && warm < high);
+    
+    // Same answer from the compile-time model
+    assert(std::abs(domain::simulateReferenceFlight(denver, drive).carry_m
+                    - simulate(denver, drive, 1.0 / 240.0).carry_m) < 1e-9);
+  }
+}
+
+TEST(render_interpolation_smooths_low_rate) {
+  // 60 Hz physics drawn at 144 fps: the raw state moves in uneven jumps
+  // (0, 1 or 2 steps per frame), the blended state by one frame each time
+  domain::PhysicsConfig config;
+  config.dt_fixed_sec = 1.0 / 60.0;
+  domain::PhysicsEngine physics(config);
+  physics.startShot(domain::LaunchCondition(50.0, 30.0));
+  assert(physics.getInterpolationAlpha() == 1.0);
+  
+  const double frame = 1.0 / 144.0;
+  double elapsed = 0.0;
+  double raw_prev = 0.0, smooth_prev = 0.0;
+  double raw_delta = 0.0, smooth_delta = 0.0;
+  double raw_jitter = 0.0, smooth_jitter = 0.0;
+  for (int i = 0; i < 200; ++i) {
+    physics.step(frame);
+    elapsed += frame;
+    if (!physics.isInFlight()) {
+      break;
+    }
+    double alpha = physics.getInterpolationAlpha();
+    assert(alpha >= 0.0 && alpha <= 1.0);
+    domain::BallState drawn = physics.getInterpolatedState();
+    double raw = physics.getCurrentState().pos.y;
+    if (i >= 2) {
+      // One step of latency: the drawn ball trails real time by exactly dt
+      assert(std::abs(drawn.t_sec - (elapsed - config.dt_fixed_sec)) < 1e-9);
+      // Change in per-frame advance between consecutive frames (once the
+      // first step has been taken on both sides)
+      if (i >= 5) {
+        raw_jitter = std::max(raw_jitter, std::abs((raw - raw_prev) - raw_delta));
+        smooth_jitter = std::max(smooth_jitter, std::abs((drawn.pos.y - smooth_prev) - smooth_delta));
+      }
+      raw_delta = raw - raw_prev;
+      smooth_delta = drawn.pos.y - smooth_prev;
+    }
+    raw_prev = raw;
+    smooth_prev = drawn.pos.y;
+  }
+  std::cout << "  frame-to-frame jitter raw " << raw_jitter << " m, interpolated "
+            << smooth_jitter << " m" << std::endl;
+  assert(raw_jitter > 0.3);
+  assert(smooth_jitter < 0.05 * raw_jitter);
+  
+  // Precompute mode plays back exact samples: nothing to blend
+  config.precompute_flight = true;
+  domain::PhysicsEngine playback(config);
+  playback.startShot(domain::LaunchCondition(50.0, 30.0));
+  playback.step(frame);
+  assert(playback.getInterpolationAlpha() == 1.0);
+  assert(playback.getInterpolatedState().pos.y == playback.getCurrentState().pos.y);
+}
+
+TEST(render_rk45_advances_every_frame) {
+  // RK45 steps grow far past a frame; the drawn ball still moves every
+  // frame, on the dense output at the current time, and the result and
+  // rest come no earlier than real time reaches them
+  domain::PhysicsConfig config;
+  config.integrator = domain::PhysicsConfig::Integrator::RK45;
+  domain::LaunchCondition launch(60.0, 14.0);
+  domain::ShotResult expected = simulate(config, launch, 1.0 / 60.0);
+  
+  domain::PhysicsEngine physics(config);
+  physics.startShot(launch);
+  const double frame = 1.0 / 60.0;
+  double elapsed = 0.0;
+  double y_prev = 0.0, longest_step = 0.0;
+  while (!physics.isAtRest()) {
+    double t_before = physics.getCurrentState().t_sec;
+    physics.step(frame);
+    elapsed += frame;
+    longest_step = std::max(longest_step, physics.getCurrentState().t_sec - t_before);
+    domain::BallState drawn = physics.getInterpolatedState();
+    if (elapsed < expected.flight_time_s) {
+      assert(std::abs(drawn.t_sec - elapsed) < 1e-9);
+      assert(drawn.pos.y > y_prev);
+      assert(drawn.pos.z > 0.0);
+      y_prev = drawn.pos.y;
+    }
+    assert(elapsed < 60.0);
+  }
+  assert(longest_step > 4.0 * frame);
+  assert(elapsed >= expected.flight_time_s);
+  
+  domain::BallState drawn = physics.getInterpolatedState();
+  assert(std::abs(drawn.pos.y - physics.getLandingState().pos.y) < 1e-9);
+  assert(physics.calculateResult().carry_m == expected.carry_m);
+}
+
 int main() {
   std::cout << "=== Domain Physics Tests ===" << std::endl;
   
@@ -154,6 +979,33 @@ int main() {
   RUN_TEST(physics_gravity_only);
   RUN_TEST(physics_drag_reduces_distance);
   RUN_TEST(physics_trajectory_points);
+  RUN_TEST(physics_precompute_matches_stepped);
+  RUN_TEST(physics_precompute_playback);
+  RUN_TEST(trajectory_sample_interpolates);
+  RUN_TEST(trajectory_bounded_keeps_apex_and_landing);
+  RUN_TEST(trajectory_storage_reused);
+  RUN_TEST(trajectory_long_climb_stays_bounded);
+  RUN_TEST(physics_rk45_matches_analytic_range);
+  RUN_TEST(physics_rk45_fewer_evaluations_with_drag);
+  RUN_TEST(physics_rk45_deterministic_across_frame_rates);
+  RUN_TEST(physics_rk45_dense_output_samples);
+  RUN_TEST(physics_touchdown_located_inside_step);
+  RUN_TEST(physics_carry_unbiased_by_step_size);
+  RUN_TEST(aero_table_interpolates);
+  RUN_TEST(physics_backspin_lifts_ball);
+  RUN_TEST(physics_side_spin_curves);
+  RUN_TEST(physics_spin_decays);
+  RUN_TEST(ground_roll_extends_total);
+  RUN_TEST(ground_backspin_checks_roll);
+  RUN_TEST(ground_precompute_matches_stepped);
+  RUN_TEST(ground_rest_is_free);
+  RUN_TEST(policy_engine_matches_configured);
+  RUN_TEST(float_engine_tracks_double);
+  RUN_TEST(reference_flight_matches_engine);
+  RUN_TEST(atmosphere_density);
+  RUN_TEST(atmosphere_changes_carry);
+  RUN_TEST(render_interpolation_smooths_low_rate);
+  RUN_TEST(render_rk45_advances_every_frame);
   
   std::cout << "\nAll tests passed!" << std::endl;
   return 0;
@@ -0,0 +1,313 @@
+#include "infrastructure/ReplaySensorProvider.hpp"
+#include "infrastructure/EventQueue.hpp"
+#include "application/ImpactDetector.hpp"
+#include "application/SimulationThread.hpp"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+using infrastructure::ReplaySensorProvider;
+using infrastructure::SensorFrame;
+
+namespace {
+
+const char* TRACE_PATH = "test_replay_trace.csv";
+
+void writeFile(const std::string& path, const std::string& text) {
+  FILE* file = std::fopen(path.c_str(), "wb");
+  assert(file);
+  std::fwrite(text.data(), 1, text.size(), file);
+  std::fclose(file);
+}
+
+std::string poseRow(double t, float ax, float az) {
+  char row[128];
+  std::snprintf(row, sizeof(row), "%.4f,Pose,%.3f,0.0,%.3f,0.0,0.0,0.0\n", t, ax, az);
+  return row;
+}
+
+// `count` frames 1 ms apart; every `corrupt_every`-th line is garbage
+std::string uniformTrace(size_t count, size_t corrupt_every) {
+  std::string text = std::string(infrastructure::TRACE_CSV_HEADER) + "\n";
+  for (size_t i = 0; i < count; ++i) {
+    if (corrupt_every > 0 && i % corrupt_every == corrupt_every - 1) {
+      text += "0.12,Pose,not-a-number,0,0,0,0,0\n";
+    }
+    text += poseRow(i * 0.001, static_cast<float>(i), 9.81f);
+  }
+  return text;
+}
+
+// Swings of half a second each: rest, then one impact spike whose size
+// sets the shot power
+std::string swingTrace(int swings) {
+  std::string text = std::string(infrastructure::TRACE_CSV_HEADER) + "\n";
+  double t = 0.0;
+  for (int s = 0; s < swings; ++s) {
+    for (int i = 0; i < 500; ++i) {
+      float az = i == 400 ? 20.0f + static_cast<float>(s % 10) : 9.81f;
+      text += poseRow(t, 0.0f, az);
+      t += 0.001;
+    }
+  }
+  return text;
+}
+
+struct Rig {
+  domain::PhysicsConfig config;
+  domain::PhysicsEngine physics{config};
+  domain::GameStateMachine state_machine;
+  application::ShotParameterService shots;
+  application::ExecuteShotUseCase execute{state_machine, physics, shots};
+  application::UpdatePhysicsUseCase update{state_machine, physics};
+  application::SimulationThread simulation{state_machine, physics, execute, update};
+};
+
+// Trace -> provider batches -> EventQueue -> ImpactDetector -> shot ->
+// physics to rest, all on this thread with no sleeps. Returns the carries.
+std::vector<double> replayPipeline(const std::string& path) {
+  ReplaySensorProvider replay(path, ReplaySensorProvider::Mode::Fast);
+  infrastructure::EventQueue queue(256, infrastructure::EventQueue::OverflowPolicy::Reject);
+  Rig rig;
+  application::ImpactDetector detector;
+  application::ShotParameters params;
+  params.club_index = 4;
+  std::vector<double> carries;
+  
+  SensorFrame batch[64];
+  size_t n;
+  while ((n = replay.pollBatch(batch, 64)) > 0) {
+    for (size_t i = 0; i < n; ++i) {
+      infrastructure::Event event;
+      event.t_sec = batch[i].t_sec;
+      event.frame = batch[i];
+      bool pushed = queue.push(event);
+      assert(pushed);
+      (void)pushed;
+    }
+    
+    infrastructure::Event event;
+    while (queue.pop(event)) {
+      application::Impact impact;
+      if (!detector.update(event.t_sec, event.frame.az, impact)) {
+        continue;
+      }
+      application::SimulationCommand arm;
+      arm.type = application::SimulationCommand::Type::Arm;
+      rig.simulation.post(arm);
+      rig.simulation.post(application::ImpactDetector::shotCommand(impact, params));
+      int ticks = 0;
+      do {
+        rig.simulation.advance(0.05);
+      } while (rig.simulation.latest().game_state != domain::GameState::Result && ++ticks < 2000);
+      assert(rig.simulation.latest().result_available);
+      carries.push_back(rig.simulation.latest().result.carry_m);
+    }
+  }
+  assert(replay.finished());
+  assert(replay.corruptRows() == 0);
+  return carries;
+}
+
+} // namespace
+
+TEST(impact_detector_reports_each_peak_once) {
+  application::ImpactDetector detector;
+  application::Impact impact;
+  double t = 0.0;
+  auto feed = [&](float az) {
+    t += 0.001;
+    return detector.update(t, az, impact);
+  };
+  
+  assert(!feed(9.81f) && !feed(14.9f));
+  // A three-sample spike is reported once it ends, at its peak
+  assert(!feed(18.0f) && !feed(27.5f) && !feed(22.0f));
+  assert(feed(9.81f));
+  assert(std::abs(impact.t_sec - 0.004) < 1e-12);
+  assert(impact.peak_mps2 == 27.5f);
+  assert(impact.power > 0.5f && impact.power < 0.6f);
+  
+  // Ringing right after the impact is ignored
+  assert(!feed(30.0f) && !feed(9.81f));
+  assert(detector.getImpactCount() == 1);
+  
+  // Power is clamped at the top, and follows the player's club and aim
+  t = 1.0;
+  assert(!feed(100.0f) && feed(0.0f));
+  assert(impact.power == application::ImpactDetector::MAX_POWER);
+  application::ShotParameters params;
+  params.club_index = 2;
+  params.aim_angle_deg = -3.0f;
+  application::SimulationCommand shoot = application::ImpactDetector::shotCommand(impact, params, 4.5);
+  assert(shoot.type == application::SimulationCommand::Type::Shoot);
+  assert(shoot.params.club_index == 2 && shoot.params.aim_angle_deg == -3.0f);
+  assert(shoot.params.power == impact.power && shoot.wind_time_offset_sec == 4.5);
+}
+
+TEST(reads_rows_and_skips_bad_ones) {
+  writeFile(TRACE_PATH,
+            std::string(infrastructure::TRACE_CSV_HEADER) + "\n"
+            "0.000,Pose,0.01,0.02,9.80,0.001,0.002,0.003\n"
+            "garbage\n"
+            "\n"
+            "0.001,Pose,1,2\n"                       // Too few columns
+            "0.002,Bogus,1,2,3,4,5,6\n"               // Unknown type
+            "0.003,Pose,1,2,3,4,5,6,7\n"              // Too many columns
+            "0.004,SwingStart,0,0,12,0,0,0\n"         // Detector row
+            "0.005,Pose,-1.5,2.25,9.75,0.5,-0.25,3\r\n"
+            "0.006,Pose,1,1,1,1,1,1");                // No final newline
+  ReplaySensorProvider replay(TRACE_PATH, ReplaySensorProvider::Mode::Fast);
+  assert(replay.isOpen());
+  
+  std::vector<SensorFrame> frames;
+  SensorFrame frame;
+  while (replay.poll(frame)) {
+    frames.push_back(frame);
+  }
+  assert(frames.size() == 3);
+  assert(frames[0].t_sec == 0.0 && frames[0].az == 9.80f && frames[0].gz == 0.003f);
+  assert(frames[1].t_sec == 0.005 && frames[1].ax == -1.5f && frames[1].gy == -0.25f && frames[1].gz == 3.0f);
+  assert(frames[2].t_sec == 0.006 && frames[2].gz == 1.0f);
+  assert(replay.corruptRows() == 4);
+  assert(replay.annotationRows() == 1);
+  assert(replay.framesDelivered() == 3);
+  assert(replay.finished());
+  
+  replay.reset();
+  assert(replay.corruptRows() == 0 && !replay.finished());
+  assert(replay.poll(frame) && frame.t_sec == 0.0);
+}
+
+TEST(missing_file_has_no_data) {
+  ReplaySensorProvider replay("does/not/exist.csv");
+  SensorFrame frame;
+  assert(!replay.isOpen());
+  assert(!replay.poll(frame));
+  assert(replay.finished());
+  replay.seek(1.0);
+  assert(!replay.poll(frame));
+}
+
+TEST(seek_bisects_to_timestamp) {
+  const size_t count = 20000;
+  writeFile(TRACE_PATH, uniformTrace(count, 97));
+  ReplaySensorProvider replay(TRACE_PATH, ReplaySensorProvider::Mode::Fast);
+  
+  SensorFrame frame;
+  for (double target : {0.0, 0.0004, 2.5005, 2.501, 7.777, 19.999}) {
+    replay.seek(target);
+    assert(replay.poll(frame));
+    // First frame at or after the target, i.e. index ceil(target / 1 ms)
+    size_t expected = 0;
+    while (expected * 0.001 < target - 1e-9) {
+      ++expected;
+    }
+    assert(frame.ax == static_cast<float>(expected));
+  }
+  
+  replay.seek(-5.0);
+  assert(replay.poll(frame) && frame.ax == 0.0f);
+  replay.seek(100.0);
+  assert(replay.finished() && !replay.poll(frame));
+  
+  // Seeking backwards then reading on stays in order
+  replay.seek(10.0);
+  float previous = -1.0f;
+  for (int i = 0; i < 500 && replay.poll(frame); ++i) {
+    assert(frame.ax == previous + 1.0f || previous < 0.0f);
+    previous = frame.ax;
+  }
+  assert(previous == 10499.0f);
+  
+  // Timing: seeks against a linear scan over the same file
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 1000; ++i) {
+    replay.seek(i * 0.0199);
+  }
+  double seek_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / 1000;
+  replay.reset();
+  start = std::chrono::steady_clock::now();
+  size_t frames = 0;
+  while (replay.poll(frame)) {
+    ++frames;
+  }
+  double scan_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  assert(frames == count);
+  assert(replay.corruptRows() == count / 97);
+  std::cout << "  seek " << seek_us << " us, full scan of " << count << " rows " << scan_us << " us" << std::endl;
+}
+
+TEST(sync_mode_follows_trace_time) {
+  // 100 frames over 99 ms
+  writeFile(TRACE_PATH, uniformTrace(100, 0));
+  ReplaySensorProvider replay(TRACE_PATH, ReplaySensorProvider::Mode::Sync);
+  
+  SensorFrame frames[128];
+  auto start = std::chrono::steady_clock::now();
+  size_t first = replay.pollBatch(frames, 128);
+  assert(first >= 1 && first < 50);  // Frame 0 is due at once, the rest later
+  assert(frames[0].t_sec == 0.0);
+  
+  size_t total = first;
+  double last_t = frames[first - 1].t_sec;
+  while (!replay.finished()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    size_t n = replay.pollBatch(frames, 128);
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (size_t i = 0; i < n; ++i) {
+      assert(frames[i].t_sec > last_t);
+      assert(frames[i].t_sec <= elapsed + 1e-9);  // Never ahead of the clock
+      last_t = frames[i].t_sec;
+    }
+    total += n;
+  }
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  assert(total == 100);
+  assert(elapsed >= 0.099);
+}
+
+TEST(fast_mode_replays_swings_through_physics) {
+  const int swings = 200;
+  writeFile(TRACE_PATH, swingTrace(swings));
+  
+  auto start = std::chrono::steady_clock::now();
+  std::vector<double> carries = replayPipeline(TRACE_PATH);
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::cout << "  " << swings << " swings (" << swings * 0.5 << " s of trace) replayed in "
+            << seconds << " s" << std::endl;
+  
+  assert(carries.size() == static_cast<size_t>(swings));
+  assert(carries[1] > carries[0]);  // Harder impact, longer shot
+  assert(carries[10] == carries[0]);
+  // Same trace, same results
+  assert(replayPipeline(TRACE_PATH) == carries);
+  std::remove(TRACE_PATH);
+}
+
+int main() {
+  std::cout << "=== Replay Sensor Provider Tests ===" << std::endl;
+  
+  RUN_TEST(impact_detector_reports_each_peak_once);
+  RUN_TEST(reads_rows_and_skips_bad_ones);
+  RUN_TEST(missing_file_has_no_data);
+  RUN_TEST(seek_bisects_to_timestamp);
+  RUN_TEST(sync_mode_follows_trace_time);
+  RUN_TEST(fast_mode_replays_swings_through_physics);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
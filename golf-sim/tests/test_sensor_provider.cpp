@@ -0,0 +1,206 @@
+#include "infrastructure/ISensorProvider.hpp"
+#include "infrastructure/MockSensorProvider.hpp"
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+using infrastructure::ISensorProvider;
+using infrastructure::MockSensorProvider;
+using infrastructure::SensorFrame;
+
+namespace {
+
+// Provider with frames already in memory that only implements poll(), so
+// pollBatch() goes through the default adapter
+class BufferedProvider : public ISensorProvider {
+public:
+  explicit BufferedProvider(size_t count) : frames_(count) {
+    for (size_t i = 0; i < count; ++i) {
+      frames_[i] = SensorFrame(i * 0.001, static_cast<float>(i), 0.0f, 9.81f, 0.0f, 0.0f, 0.0f);
+    }
+  }
+  
+  bool poll(SensorFrame& out) override {
+    if (next_ == frames_.size()) {
+      return false;
+    }
+    out = frames_[next_++];
+    return true;
+  }
+  
+  void reset() override { next_ = 0; }
+
+protected:
+  std::vector<SensorFrame> frames_;
+  size_t next_ = 0;
+};
+
+// The same provider with a native batch poll: one virtual call per batch
+class BatchedBufferedProvider : public BufferedProvider {
+public:
+  explicit BatchedBufferedProvider(size_t count) : BufferedProvider(count) {}
+  
+  size_t pollBatch(SensorFrame* out, size_t capacity) override {
+    size_t n = std::min(capacity, frames_.size() - next_);
+    std::memcpy(out, frames_.data() + next_, n * sizeof(SensorFrame));
+    next_ += n;
+    return n;
+  }
+};
+
+bool sameFrame(const SensorFrame& a, const SensorFrame& b) {
+  return a.t_sec == b.t_sec && a.ax == b.ax && a.ay == b.ay && a.az == b.az
+      && a.gx == b.gx && a.gy == b.gy && a.gz == b.gz;
+}
+
+// Hides the dynamic type from the optimizer, as for the input thread,
+// which only sees an ISensorProvider& from another translation unit
+ISensorProvider& opaque(ISensorProvider& provider) {
+  ISensorProvider* p = &provider;
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : "+r"(p));
+#endif
+  return *p;
+}
+
+// Frames per second draining `provider` one virtual poll() at a time
+double pollRate(ISensorProvider& source, size_t expected) {
+  ISensorProvider& provider = opaque(source);
+  auto start = std::chrono::steady_clock::now();
+  SensorFrame frame;
+  size_t count = 0;
+  float checksum = 0.0f;
+  while (provider.poll(frame)) {
+    checksum += frame.az;
+    ++count;
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  assert(count == expected && checksum > 0.0f);
+  return count / seconds;
+}
+
+// Frames per second draining `provider` in batches of 64
+double batchRate(ISensorProvider& source, size_t expected) {
+  ISensorProvider& provider = opaque(source);
+  auto start = std::chrono::steady_clock::now();
+  SensorFrame frames[64];
+  size_t count = 0;
+  float checksum = 0.0f;
+  size_t n;
+  while ((n = provider.pollBatch(frames, 64)) > 0) {
+    for (size_t i = 0; i < n; ++i) {
+      checksum += frames[i].az;
+    }
+    count += n;
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  assert(count == expected && checksum > 0.0f);
+  return count / seconds;
+}
+
+} // namespace
+
+TEST(default_adapter_respects_capacity) {
+  BufferedProvider provider(10);
+  ISensorProvider& p = provider;
+  SensorFrame frames[4];
+  assert(p.pollBatch(frames, 0) == 0);
+  assert(p.pollBatch(frames, 4) == 4);
+  assert(frames[0].ax == 0.0f && frames[3].ax == 3.0f);
+  assert(p.pollBatch(frames, 4) == 4);
+  assert(frames[0].ax == 4.0f);
+  assert(p.pollBatch(frames, 4) == 2);
+  assert(frames[1].ax == 9.0f);
+  assert(p.pollBatch(frames, 4) == 0);
+}
+
+TEST(mock_batch_matches_single_polls) {
+  // Same seed: batched and one-at-a-time polling yield identical streams
+  MockSensorProvider single(MockSensorProvider::Scenario::Slice, 7);
+  MockSensorProvider batched(MockSensorProvider::Scenario::Slice, 7);
+  single.triggerImpact(60.0, 12.0);
+  batched.triggerImpact(60.0, 12.0);
+  single.streamFrames(100);
+  batched.streamFrames(100);
+  
+  std::vector<SensorFrame> a;
+  SensorFrame frame;
+  while (single.poll(frame)) {
+    a.push_back(frame);
+  }
+  std::vector<SensorFrame> b(128);
+  size_t total = 0;
+  size_t n;
+  while ((n = batched.pollBatch(b.data() + total, 16)) > 0) {
+    total += n;
+  }
+  b.resize(total);
+  
+  assert(a.size() == 101 && b.size() == 101);
+  for (size_t i = 0; i < a.size(); ++i) {
+    assert(sameFrame(a[i], b[i]));
+  }
+  assert(a[0].az > 19.0f);                   // Impact first
+  assert(a[1].az > 9.0f && a[1].az < 10.0f);  // Then the streamed rest frames
+  assert(a[100].t_sec > a[1].t_sec);
+}
+
+TEST(mock_batch_drains_then_stops) {
+  MockSensorProvider mock;
+  SensorFrame frames[8];
+  assert(mock.pollBatch(frames, 8) == 0);
+  mock.triggerImpact(50.0, 10.0);
+  assert(mock.pollBatch(frames, 8) == 1);
+  assert(mock.pollBatch(frames, 8) == 0);  // One-shot
+  mock.streamFrames(5);
+  assert(mock.pollBatch(frames, 8) == 5);
+  mock.streamFrames(5);
+  mock.reset();
+  assert(mock.pollBatch(frames, 8) == 0);
+}
+
+TEST(batch_poll_benchmark) {
+  const size_t n = 2000000;
+  
+  BufferedProvider single_source(n);
+  BatchedBufferedProvider batch_source(n);
+  double single = pollRate(single_source, n);
+  single_source.reset();
+  double adapted = batchRate(single_source, n);
+  double native = batchRate(batch_source, n);
+  std::cout << "  buffered provider: poll() " << single / 1e6 << " M frames/s, default pollBatch() "
+            << adapted / 1e6 << " M, native pollBatch() " << native / 1e6 << " M" << std::endl;
+  
+  MockSensorProvider mock_single;
+  MockSensorProvider mock_batch;
+  mock_single.streamFrames(n / 4);
+  mock_batch.streamFrames(n / 4);
+  double mock_poll = pollRate(mock_single, n / 4);
+  double mock_native = batchRate(mock_batch, n / 4);
+  std::cout << "  mock provider: poll() " << mock_poll / 1e6 << " M frames/s, native pollBatch() "
+            << mock_native / 1e6 << " M" << std::endl;
+}
+
+int main() {
+  std::cout << "=== Sensor Provider Tests ===" << std::endl;
+  
+  RUN_TEST(default_adapter_respects_capacity);
+  RUN_TEST(mock_batch_matches_single_polls);
+  RUN_TEST(mock_batch_drains_then_stops);
+  RUN_TEST(batch_poll_benchmark);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
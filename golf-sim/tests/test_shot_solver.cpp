@@ -0,0 +1,187 @@
+#include "application/ShotSolver.hpp"
+#include "domain/PhysicsEngine.hpp"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <cassert>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+namespace {
+
+domain::PhysicsConfig makeConfig(const domain::Vec3& wind) {
+  domain::PhysicsConfig config;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  config.wind_velocity = wind;
+  return config;
+}
+
+// Independent check: fly the solved parameters with a fresh engine
+domain::Vec3 fly(const application::ShotParameterService& shots,
+                 const domain::PhysicsConfig& config,
+                 int club, const application::ShotSolution& solution,
+                 const domain::WindField* wind_field = nullptr, float spin_axis_deg = 0.0f) {
+  application::ShotParameters params;
+  params.club_index = club;
+  params.power = solution.power;
+  params.aim_angle_deg = solution.aim_angle_deg;
+  params.spin_axis_deg = spin_axis_deg;
+  
+  domain::PhysicsConfig adaptive = config;
+  adaptive.integrator = domain::PhysicsConfig::Integrator::RK45;
+  domain::PhysicsEngine engine(adaptive);
+  engine.setWindField(wind_field);
+  engine.startShot(shots.createLaunchCondition(params));
+  while (!engine.hasLanded()) {
+    engine.step(1.0 / 60.0);
+  }
+  return engine.calculateResult().landing_position;
+}
+
+} // namespace
+
+TEST(solver_hits_target) {
+  application::ShotParameterService shots;
+  domain::PhysicsConfig config = makeConfig(domain::Vec3(1.0, 0.0, 0.0));
+  application::ShotSolver solver(shots, config);
+  
+  application::ShotSolution s = solver.solve(0, {150.0, 0.0});
+  assert(s.status == application::ShotSolution::Status::Solved);
+  assert(s.power > application::ShotSolver::MIN_POWER && s.power < application::ShotSolver::MAX_POWER);
+  
+  domain::Vec3 landing = fly(shots, config, 0, s);
+  assert(std::hypot(landing.x, landing.y - 150.0) < application::ShotSolver::TOLERANCE_M);
+}
+
+TEST(solver_aims_into_crosswind) {
+  application::ShotParameterService shots;
+  domain::PhysicsConfig config = makeConfig(domain::Vec3(5.0, 0.0, 0.0));  // Blowing right
+  application::ShotSolver solver(shots, config);
+  
+  application::ShotSolution s = solver.solve(3, {90.0, -4.0});
+  assert(s.status == application::ShotSolution::Status::Solved);
+  assert(s.aim_angle_deg < -2.5);  // Aims left of the target bearing
+  
+  domain::Vec3 landing = fly(shots, config, 3, s);
+  assert(std::hypot(landing.x + 4.0, landing.y - 90.0) < application::ShotSolver::TOLERANCE_M);
+}
+
+TEST(solver_warm_start_saves_flights) {
+  application::ShotParameterService shots;
+  application::ShotSolver solver(shots, makeConfig(domain::Vec3(1.0, 0.0, 0.0)));
+  
+  application::ShotSolution cold = solver.solve(2, {120.0, 0.0});
+  application::ShotSolution same = solver.solve(2, {120.0, 0.0});
+  application::ShotSolution near = solver.solve(2, {121.0, 0.0});
+  assert(same.simulations == 1);
+  assert(near.simulations < cold.simulations);
+  assert(near.status == application::ShotSolution::Status::Solved);
+  
+  // Warm start is per club
+  application::ShotSolution other = solver.solve(1, {121.0, 0.0});
+  assert(other.status == application::ShotSolution::Status::Solved);
+}
+
+TEST(solver_allows_for_spin_axis) {
+  application::ShotParameterService shots;
+  domain::PhysicsConfig config = makeConfig(domain::Vec3(1.0, 0.0, 0.0));
+  application::ShotSolver solver(shots, config);
+  
+  // A fade curves right, so the solver aims further left; warm-started
+  // from the straight shot, it still lands on the target
+  application::ShotSolution straight = solver.solve(3, {100.0, 0.0});
+  application::ShotSolution fade = solver.solve(3, {100.0, 0.0}, 15.0f);
+  assert(straight.status == application::ShotSolution::Status::Solved);
+  assert(fade.status == application::ShotSolution::Status::Solved);
+  assert(fade.aim_angle_deg < straight.aim_angle_deg - 1.0f);
+  
+  domain::Vec3 landing = fly(shots, config, 3, fade, nullptr, 15.0f);
+  assert(std::hypot(landing.x, landing.y - 100.0) < application::ShotSolver::TOLERANCE_M);
+}
+
+TEST(solver_reports_why_unsolved) {
+  application::ShotParameterService shots;
+  application::ShotSolver solver(shots, makeConfig(domain::Vec3()));
+  
+  application::ShotSolution s = solver.solve(4, {400.0, 0.0});
+  assert(s.status == application::ShotSolution::Status::TooLong);
+  assert(s.power == application::ShotSolver::MAX_POWER);
+  assert(s.landing.y < 400.0);
+  
+  // Past the target even at the lowest power
+  s = solver.solve(0, {1.0, 0.0});
+  assert(s.status == application::ShotSolution::Status::TooShort);
+  assert(s.power == application::ShotSolver::MIN_POWER);
+  assert(s.landing.y > 1.0);
+  
+  // In range, but off to the side by more than the aim limit allows
+  s = solver.solve(3, {60.0, 80.0});
+  assert(s.status == application::ShotSolution::Status::NotConverged);
+  assert(std::abs(s.aim_angle_deg) == application::ShotSolver::MAX_AIM_DEG);
+  assert(s.simulations < application::ShotSolver::MAX_ITERATIONS);
+}
+
+TEST(solver_flies_hole_wind_field) {
+  application::ShotParameterService shots;
+  domain::PhysicsConfig config = makeConfig(domain::Vec3(1.0, 0.0, 0.0));
+  application::ShotSolver solver(shots, config);
+  application::ShotSolution calm = solver.solve(3, {100.0, 0.0});
+  
+  // A hole with a strong crosswind toward +x
+  domain::WindFieldConfig wind;
+  wind.speed_mps = 8.0;
+  wind.direction_deg = 0.0;
+  auto field = std::make_shared<const domain::WindField>(wind);
+  solver.setWindField(field);
+  
+  // Warm start dropped: the old solution no longer lands on the target
+  application::ShotSolution s = solver.solve(3, {100.0, 0.0});
+  assert(s.status == application::ShotSolution::Status::Solved);
+  assert(s.simulations > 1);
+  assert(s.aim_angle_deg < calm.aim_angle_deg - 2.0f);
+  
+  domain::Vec3 landing = fly(shots, config, 3, s, field.get());
+  assert(std::hypot(landing.x, landing.y - 100.0) < application::ShotSolver::TOLERANCE_M);
+}
+
+TEST(solver_timing) {
+  // Informational: per-frame cost while the player adjusts inputs
+  application::ShotParameterService shots;
+  application::ShotSolver solver(shots, makeConfig(domain::Vec3(1.0, 0.0, 0.0)));
+  solver.solve(0, {180.0, 0.0});
+  
+  const int frames = 200;
+  int simulations = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < frames; ++i) {
+    application::ShotSolution s = solver.solve(0, {180.0 + 0.1 * i, 0.0});
+    simulations += s.simulations;
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  double ms = std::chrono::duration<double, std::milli>(t1 - t0).count() / frames;
+  std::cout << "  " << ms << " ms/solve, " << static_cast<double>(simulations) / frames
+            << " flights/solve" << std::endl;
+  assert(simulations <= 3 * frames);
+}
+
+int main() {
+  std::cout << "=== Shot Solver Tests ===" << std::endl;
+  
+  RUN_TEST(solver_hits_target);
+  RUN_TEST(solver_aims_into_crosswind);
+  RUN_TEST(solver_warm_start_saves_flights);
+  RUN_TEST(solver_allows_for_spin_axis);
+  RUN_TEST(solver_reports_why_unsolved);
+  RUN_TEST(solver_flies_hole_wind_field);
+  RUN_TEST(solver_timing);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,195 @@
+#include "domain/SimdMath.hpp"
+#include "domain/Vec3.hpp"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+namespace {
+
+using namespace domain::simd;
+
+// Deterministic values in [-range, range]
+struct Lcg {
+  uint32_t state = 12345u;
+  float next(float range) {
+    state = state * 1664525u + 1013904223u;
+    return (static_cast<float>(state >> 8) / 16777216.0f * 2.0f - 1.0f) * range;
+  }
+};
+
+bool sameBits(float a, float b) {
+  return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+struct Columns {
+  std::vector<float> x, y, z;
+  
+  explicit Columns(size_t n, uint32_t seed = 12345u) : x(n), y(n), z(n) {
+    Lcg rng;
+    rng.state = seed;
+    for (size_t i = 0; i < n; ++i) {
+      x[i] = rng.next(80.0f);
+      y[i] = rng.next(80.0f);
+      z[i] = rng.next(80.0f);
+    }
+  }
+};
+
+} // namespace
+
+TEST(vec3x4_matches_scalar_vec3) {
+  Columns a(64, 1u);
+  Columns b(64, 2u);
+  for (size_t i = 0; i < 64; i += LANES) {
+    Vec3x4 va = load3(&a.x[i], &a.y[i], &a.z[i]);
+    Vec3x4 vb = load3(&b.x[i], &b.y[i], &b.z[i]);
+    float s = a.x[i] * 0.01f;
+    
+    float out[6][LANES];
+    Vec3x4 sum = add(va, vb);
+    Vec3x4 diff = sub(va, vb);
+    Vec3x4 scaled = scale(va, splat4(s));
+    store4(out[0], sum.x);
+    store4(out[1], diff.y);
+    store4(out[2], scaled.z);
+    store4(out[3], dot(va, vb));
+    store4(out[4], length(va));
+    store4(out[5], normalize(va).x);
+    
+    for (size_t l = 0; l < LANES; ++l) {
+      domain::Vec3f sa(a.x[i + l], a.y[i + l], a.z[i + l]);
+      domain::Vec3f sb(b.x[i + l], b.y[i + l], b.z[i + l]);
+      assert(sameBits(out[0][l], (sa + sb).x));
+      assert(sameBits(out[1][l], (sa - sb).y));
+      assert(sameBits(out[2][l], (sa * s).z));
+      assert(sameBits(out[3][l], sa.dot(sb)));
+      assert(sameBits(out[4][l], sa.length()));
+      assert(sameBits(out[5][l], sa.normalized().x));
+    }
+  }
+}
+
+TEST(normalize_batch_matches_scalar_vec3) {
+  // Not a multiple of the lane count; includes zero and tiny vectors
+  const size_t n = 37;
+  Columns c(n);
+  c.x[3] = c.y[3] = c.z[3] = 0.0f;
+  c.x[36] = 1e-12f;
+  c.y[36] = c.z[36] = 0.0f;
+  Columns expected = c;
+  
+  normalizeBatch(c.x.data(), c.y.data(), c.z.data(), n);
+  for (size_t i = 0; i < n; ++i) {
+    domain::Vec3f v = domain::Vec3f(expected.x[i], expected.y[i], expected.z[i]).normalized();
+    assert(sameBits(c.x[i], v.x));
+    assert(sameBits(c.y[i], v.y));
+    assert(sameBits(c.z[i], v.z));
+  }
+  assert(c.x[3] == 0.0f && c.x[36] == 0.0f);
+}
+
+TEST(reciprocal_length_refined) {
+  const size_t n = 203;
+  Columns c(n);
+  c.x[10] = c.y[10] = c.z[10] = 0.0f;
+  std::vector<float> out(n);
+  reciprocalLengthBatch(c.x.data(), c.y.data(), c.z.data(), out.data(), n);
+  
+  double worst = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    if (i == 10) {
+      assert(std::isinf(out[i]) && out[i] > 0.0f);
+      continue;
+    }
+    double len = std::sqrt(static_cast<double>(c.x[i]) * c.x[i] +
+                           static_cast<double>(c.y[i]) * c.y[i] +
+                           static_cast<double>(c.z[i]) * c.z[i]);
+    worst = std::max(worst, std::abs(out[i] * len - 1.0));
+  }
+  std::cout << "  " << BACKEND << " rsqrt max relative error " << worst << std::endl;
+  assert(worst < 1e-6);
+}
+
+TEST(interleave_matches_scalar) {
+  for (size_t n : {0u, 1u, 3u, 4u, 5u, 8u, 37u}) {
+    Columns c(n);
+    std::vector<float> out(3 * n + 1, -1.0f);  // Sentinel past the end
+    interleaveTranslated(c.x.data(), c.y.data(), c.z.data(), 0.5f, -17.5f, 0.0f, out.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+      assert(sameBits(out[3 * i], c.x[i] + 0.5f));
+      assert(sameBits(out[3 * i + 1], c.y[i] + -17.5f));
+      assert(sameBits(out[3 * i + 2], c.z[i] + 0.0f));
+    }
+    assert(out[3 * n] == -1.0f);
+  }
+}
+
+TEST(vec4_matches_scalar) {
+  Vec4 a = makeVec4(1.5f, -2.25f, 3.0f, 1.0f);
+  Vec4 b = makeVec4(0.1f, 0.2f, -0.3f, 0.0f);
+  float out[4];
+  storeVec4(out, add(mul(a, b), scale(sub(a, b), 0.75f)));
+  const float sa[4] = {1.5f, -2.25f, 3.0f, 1.0f};
+  const float sb[4] = {0.1f, 0.2f, -0.3f, 0.0f};
+  for (int i = 0; i < 4; ++i) {
+    assert(sameBits(out[i], sa[i] * sb[i] + (sa[i] - sb[i]) * 0.75f));
+  }
+}
+
+TEST(normalize_batch_timing) {
+  const size_t n = 4096;
+  const int rounds = 200;
+  Columns c(n);
+  
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r) {
+    Columns work = c;
+    normalizeBatch(work.x.data(), work.y.data(), work.z.data(), n);
+    assert(std::abs(work.x[0] * work.x[0] + work.y[0] * work.y[0] + work.z[0] * work.z[0] - 1.0f) < 1e-5f);
+  }
+  double simd_us = std::chrono::duration<double, std::micro>(
+    std::chrono::steady_clock::now() - start).count() / rounds;
+  
+  start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r) {
+    Columns work = c;
+    for (size_t i = 0; i < n; ++i) {
+      domain::Vec3f v = domain::Vec3f(work.x[i], work.y[i], work.z[i]).normalized();
+      work.x[i] = v.x;
+      work.y[i] = v.y;
+      work.z[i] = v.z;
+    }
+    assert(std::abs(work.x[0] * work.x[0] + work.y[0] * work.y[0] + work.z[0] * work.z[0] - 1.0f) < 1e-5f);
+  }
+  double scalar_us = std::chrono::duration<double, std::micro>(
+    std::chrono::steady_clock::now() - start).count() / rounds;
+  
+  std::cout << "  " << BACKEND << ": " << simd_us << " us vs Vec3f " << scalar_us
+            << " us per " << n << " vectors (incl. copy)" << std::endl;
+}
+
+int main() {
+  std::cout << "=== SIMD Math Tests (" << BACKEND << ") ===" << std::endl;
+  
+  RUN_TEST(vec3x4_matches_scalar_vec3);
+  RUN_TEST(normalize_batch_matches_scalar_vec3);
+  RUN_TEST(reciprocal_length_refined);
+  RUN_TEST(interleave_matches_scalar);
+  RUN_TEST(vec4_matches_scalar);
+  RUN_TEST(normalize_batch_timing);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
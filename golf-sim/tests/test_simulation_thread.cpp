@@ -0,0 +1,189 @@
+#include "application/SimulationThread.hpp"
+#include "application/TripleBuffer.hpp"
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cassert>
+#include <thread>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+namespace {
+
+domain::PhysicsConfig makeConfig() {
+  domain::PhysicsConfig config;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  config.ground_phase = true;
+  return config;
+}
+
+// Short pitch: keeps the real-time threaded test quick
+application::ShotParameters pitch() {
+  application::ShotParameters params;
+  params.club_index = 4;
+  params.power = 0.35f;
+  params.aim_angle_deg = 3.0f;
+  return params;
+}
+
+// Engine, state machine and use cases wired like App
+struct Rig {
+  domain::PhysicsConfig config = makeConfig();
+  domain::PhysicsEngine physics{config};
+  domain::GameStateMachine state_machine;
+  application::ShotParameterService shots;
+  application::ExecuteShotUseCase execute{state_machine, physics, shots};
+  application::UpdatePhysicsUseCase update{state_machine, physics};
+  application::SimulationThread simulation;
+  
+  explicit Rig(const application::SimulationConfig& sim_config = application::SimulationConfig())
+    : simulation(state_machine, physics, execute, update, sim_config) {}
+  
+  void shoot() {
+    application::SimulationCommand arm;
+    arm.type = application::SimulationCommand::Type::Arm;
+    simulation.post(arm);
+    application::SimulationCommand shot;
+    shot.type = application::SimulationCommand::Type::Shoot;
+    shot.params = pitch();
+    simulation.post(shot);
+  }
+};
+
+struct Payload {
+  uint64_t sequence = 0;
+  uint64_t values[64] = {};
+};
+
+} // namespace
+
+TEST(triple_buffer_never_tears) {
+  application::TripleBuffer<Payload> buffer;
+  const uint64_t count = 2000000;
+  std::atomic<bool> done{false};
+  
+  std::thread writer([&] {
+    for (uint64_t seq = 1; seq <= count; ++seq) {
+      Payload& p = buffer.writeBuffer();
+      p.sequence = seq;
+      for (uint64_t& v : p.values) v = seq;
+      buffer.publish();
+    }
+    done.store(true);
+  });
+  
+  uint64_t last = 0;
+  uint64_t taken = 0;
+  for (;;) {
+    bool finished = done.load();
+    if (!buffer.acquire()) {
+      if (finished) break;
+      continue;
+    }
+    const Payload& p = buffer.readBuffer();
+    assert(p.sequence > last);  // Newer every time, never a stale slot
+    for (uint64_t v : p.values) {
+      assert(v == p.sequence);  // Never half-written
+    }
+    last = p.sequence;
+    ++taken;
+  }
+  writer.join();
+  assert(last == count);  // The last value is never lost
+  std::cout << "  reader took " << taken << " of " << count << " publishes" << std::endl;
+}
+
+TEST(single_threaded_matches_direct_engine) {
+  Rig rig;
+  rig.shoot();
+  int ticks = 0;
+  while (rig.simulation.latest().game_state != domain::GameState::Result && ticks < 20000) {
+    rig.simulation.advance(1.0 / 240.0);
+    ++ticks;
+  }
+  const application::SimulationSnapshot& snap = rig.simulation.latest();
+  assert(snap.game_state == domain::GameState::Result);
+  assert(snap.result_available);
+  assert(snap.tick == static_cast<uint64_t>(ticks));
+  assert(!snap.trail.empty());
+  
+  // Same launch straight through an engine
+  domain::PhysicsEngine direct(makeConfig());
+  direct.startShot(application::ShotParameterService().createLaunchCondition(pitch()));
+  while (!direct.isAtRest()) {
+    direct.step(1.0 / 240.0);
+  }
+  assert(direct.calculateResult().total_m == snap.result.total_m);
+  assert(direct.calculateResult().carry_m == snap.result.carry_m);
+}
+
+TEST(threaded_run_is_deterministic) {
+  // Fixed-rate ticks: the thread reproduces the single-threaded result
+  // exactly, whatever the scheduler does
+  application::SimulationConfig sim_config;
+  sim_config.rate_hz = 240.0;
+  Rig rig(sim_config);
+  rig.simulation.start();
+  rig.shoot();
+  
+  auto start = std::chrono::steady_clock::now();
+  uint64_t last_tick = 0;
+  domain::GameState state = domain::GameState::Idle;
+  while (std::chrono::steady_clock::now() - start < std::chrono::seconds(20)) {
+    const application::SimulationSnapshot& snap = rig.simulation.latest();
+    assert(snap.tick >= last_tick);
+    last_tick = snap.tick;
+    state = snap.game_state;
+    if (state == domain::GameState::Result) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  rig.simulation.stop();
+  assert(state == domain::GameState::Result);
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  
+  Rig reference;
+  reference.shoot();
+  while (reference.simulation.latest().game_state != domain::GameState::Result) {
+    reference.simulation.advance(1.0 / 240.0);
+  }
+  assert(rig.simulation.latest().result.total_m == reference.simulation.latest().result.total_m);
+  std::cout << "  shot done in " << elapsed << " s real time, " << rig.simulation.getTickCount()
+            << " ticks, " << rig.simulation.getLateTickCount() << " late, "
+            << rig.simulation.getDroppedTickCount() << " dropped" << std::endl;
+}
+
+TEST(next_hole_resets) {
+  Rig rig;
+  rig.shoot();
+  rig.simulation.advance(1.0 / 240.0);
+  assert(rig.simulation.latest().game_state == domain::GameState::InFlight);
+  
+  application::SimulationCommand next;
+  next.type = application::SimulationCommand::Type::NextHole;
+  rig.simulation.post(next);
+  rig.simulation.advance(1.0 / 240.0);
+  const application::SimulationSnapshot& snap = rig.simulation.latest();
+  assert(snap.game_state == domain::GameState::Idle);
+  assert(snap.trail.empty() && !snap.result_available);
+}
+
+int main() {
+  std::cout << "=== Simulation Thread Tests ===" << std::endl;
+  
+  RUN_TEST(triple_buffer_never_tears);
+  RUN_TEST(single_threaded_matches_direct_engine);
+  RUN_TEST(threaded_run_is_deterministic);
+  RUN_TEST(next_hole_resets);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
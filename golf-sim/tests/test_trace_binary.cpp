@@ -0,0 +1,449 @@
+#include "infrastructure/TraceBinary.hpp"
+#include "infrastructure/TraceCsv.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+using infrastructure::Event;
+using infrastructure::SensorFrame;
+using infrastructure::TraceBinaryConfig;
+using infrastructure::TraceBinaryReader;
+using infrastructure::TraceBinaryWriter;
+
+namespace {
+
+const char* BINARY_PATH = "test_trace_binary.gstrace";
+const char* CSV_PATH = "test_trace_binary.csv";
+const char* CSV_BACK_PATH = "test_trace_binary_back.csv";
+
+struct Lcg {
+  uint32_t state = 2024u;
+  float next() {  // [-1, 1)
+    state = state * 1664525u + 1013904223u;
+    return static_cast<float>(state >> 8) / 16777216.0f * 2.0f - 1.0f;
+  }
+};
+
+// A 4 kHz IMU at rest-ish: slow motion plus a little noise, with a
+// detector event every 500 rows
+std::vector<Event> makeTrace(size_t count) {
+  Lcg rng;
+  std::vector<Event> events(count);
+  for (size_t i = 0; i < count; ++i) {
+    double t = 1234.5 + static_cast<double>(i) * 0.00025;
+    float slow = static_cast<float>(std::sin(t * 8.0));
+    Event& e = events[i];
+    e.type = i % 500 == 499 ? Event::Type::Impact : Event::Type::Pose;
+    e.t_sec = t;
+    e.frame = SensorFrame(t, 0.3f * slow + 0.02f * rng.next(), -0.1f + 0.02f * rng.next(),
+                          9.81f + 0.02f * rng.next(), 0.05f * slow + 0.002f * rng.next(),
+                          0.002f * rng.next(), -0.01f + 0.002f * rng.next());
+  }
+  return events;
+}
+
+bool within(double a, double b, double step) {
+  // Half a step, plus float rounding of the decoded value
+  return std::fabs(a - b) <= step * 0.5 + std::fabs(b) * 1e-7;
+}
+
+bool closeEvent(const Event& a, const Event& b, const TraceBinaryConfig& config) {
+  const SensorFrame& f = a.frame;
+  const SensorFrame& g = b.frame;
+  return a.type == b.type && within(a.t_sec, b.t_sec, config.time_step) && f.t_sec == a.t_sec
+      && within(f.ax, g.ax, config.accel_step) && within(f.ay, g.ay, config.accel_step)
+      && within(f.az, g.az, config.accel_step) && within(f.gx, g.gx, config.gyro_step)
+      && within(f.gy, g.gy, config.gyro_step) && within(f.gz, g.gz, config.gyro_step);
+}
+
+void writeTrace(const std::vector<Event>& events, const TraceBinaryConfig& config) {
+  TraceBinaryWriter writer(BINARY_PATH, config);
+  assert(writer.isOpen());
+  for (const Event& e : events) {
+    bool ok = writer.append(e);
+    assert(ok);
+    (void)ok;
+  }
+  bool ok = writer.finish();
+  assert(ok);
+  (void)ok;
+}
+
+std::vector<Event> readAll(const TraceBinaryReader& reader) {
+  std::vector<Event> all;
+  std::vector<Event> block;
+  for (size_t b = 0; b < reader.blockCount(); ++b) {
+    if (reader.readBlock(b, block)) {
+      all.insert(all.end(), block.begin(), block.end());
+    }
+  }
+  return all;
+}
+
+// Flips one bit of the file at `offset`
+void corrupt(const char* path, long offset) {
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekg(offset);
+  char byte = 0;
+  file.read(&byte, 1);
+  byte ^= 0x10;
+  file.seekp(offset);
+  file.write(&byte, 1);
+}
+
+uint32_t crc32(const std::vector<uint8_t>& bytes, size_t begin, size_t end) {
+  uint32_t crc = 0xffffffffu;
+  for (size_t i = begin; i < end; ++i) {
+    crc ^= bytes[i];
+    for (int k = 0; k < 8; ++k) {
+      crc = (crc & 1u) ? 0xedb88320u ^ (crc >> 1) : crc >> 1;
+    }
+  }
+  return crc ^ 0xffffffffu;
+}
+
+uint64_t getLe(const std::vector<uint8_t>& bytes, size_t at, int width) {
+  uint64_t value = 0;
+  for (int i = 0; i < width; ++i) {
+    value |= static_cast<uint64_t>(bytes[at + i]) << (8 * i);
+  }
+  return value;
+}
+
+void putLe(std::vector<uint8_t>& bytes, size_t at, uint64_t value, int width) {
+  for (int i = 0; i < width; ++i) {
+    bytes[at + i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+// Rewrites the row count of a one-block trace everywhere it appears (block
+// header, index entry, footer total) with every CRC fixed up, as a hostile
+// file would
+void forgeCount(const char* path, uint32_t count) {
+  std::vector<uint8_t> bytes;
+  {
+    std::ifstream file(path, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  const size_t block = 48;
+  size_t payload = getLe(bytes, block + 8, 4);
+  putLe(bytes, block + 4, count, 4);
+  putLe(bytes, block + 20 + payload, crc32(bytes, block + 4, block + 20 + payload), 4);
+  
+  size_t footer = bytes.size() - 24;
+  size_t index = getLe(bytes, footer, 8);
+  putLe(bytes, index + 8 + 16, count, 4);
+  putLe(bytes, footer - 4, crc32(bytes, index, footer - 4), 4);
+  putLe(bytes, footer + 8, count, 8);
+  
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+std::string csvText(const std::vector<Event>& events) {
+  std::string text = std::string(infrastructure::TRACE_CSV_HEADER) + "\n";
+  char row[infrastructure::TRACE_CSV_MAX_ROW];
+  for (const Event& e : events) {
+    text.append(row, infrastructure::formatTraceRow(e, row));
+  }
+  return text;
+}
+
+} // namespace
+
+TEST(round_trip_within_half_a_step) {
+  TraceBinaryConfig config;
+  config.block_records = 1000;
+  std::vector<Event> events = makeTrace(10500);
+  writeTrace(events, config);
+  
+  TraceBinaryReader reader(BINARY_PATH);
+  assert(reader.isOpen() && reader.indexed());
+  assert(reader.blockCount() == 11);
+  assert(reader.recordCount() == events.size());
+  assert(reader.config().block_records == 1000 && reader.config().accel_step == config.accel_step);
+  
+  std::vector<Event> decoded = readAll(reader);
+  assert(decoded.size() == events.size());
+  for (size_t i = 0; i < events.size(); ++i) {
+    assert(closeEvent(decoded[i], events[i], config));
+  }
+}
+
+TEST(awkward_values) {
+  TraceBinaryConfig config;
+  config.block_records = 8;
+  std::vector<Event> events(20);
+  for (size_t i = 0; i < events.size(); ++i) {
+    // Time running backwards, big jumps in sign and size
+    double t = (i % 3 == 0 ? -1.0 : 1.0) * 1e6 / static_cast<double>(i + 1);
+    float big = (i % 2 == 0 ? 1.0f : -1.0f) * 1e9f;
+    events[i].type = static_cast<Event::Type>(i % 4);
+    events[i].t_sec = t;
+    events[i].frame = SensorFrame(t, big, 0.0f, -big, 1e-7f, 3e5f, -3e5f);
+  }
+  writeTrace(events, config);
+  
+  TraceBinaryReader reader(BINARY_PATH);
+  std::vector<Event> decoded = readAll(reader);
+  assert(decoded.size() == events.size());
+  for (size_t i = 0; i < events.size(); ++i) {
+    assert(closeEvent(decoded[i], events[i], config));
+  }
+  
+  // Nothing that cannot be quantized gets in
+  TraceBinaryWriter writer(BINARY_PATH);
+  Event bad;
+  bad.frame.ax = NAN;
+  assert(!writer.append(bad));
+  bad.frame.ax = 0.0f;
+  bad.t_sec = 1e300;
+  assert(!writer.append(bad));
+  bad.t_sec = 0.0;
+  bad.type = static_cast<Event::Type>(7);
+  assert(!writer.append(bad));
+  assert(writer.rejected() == 3 && writer.records() == 0);
+}
+
+TEST(corruption_is_detected) {
+  TraceBinaryConfig config;
+  config.block_records = 1000;
+  std::vector<Event> events = makeTrace(5000);
+  writeTrace(events, config);
+  
+  size_t size = 0;
+  size_t third_block = 0;
+  {
+    size = TraceBinaryReader(BINARY_PATH).sizeBytes();
+    // Block sizes vary: find the third block's magic after the 48-byte header
+    std::ifstream file(BINARY_PATH, std::ios::binary);
+    std::vector<char> bytes(size);
+    file.read(bytes.data(), static_cast<std::streamsize>(size));
+    size_t found = 0;
+    for (size_t i = 48; i + 4 <= size; ++i) {
+      if (std::memcmp(bytes.data() + i, "GSBK", 4) == 0 && ++found == 3) {
+        third_block = i;
+        break;
+      }
+    }
+    assert(third_block > 0);
+  }
+  
+  // One bit in a payload: only that block is lost
+  corrupt(BINARY_PATH, static_cast<long>(third_block + 100));
+  {
+    TraceBinaryReader reader(BINARY_PATH);
+    assert(reader.indexed() && reader.blockCount() == 5);
+    std::vector<Event> block;
+    assert(reader.readBlock(1, block) && block.size() == 1000);
+    assert(!reader.readBlock(2, block) && block.empty());
+    assert(readAll(reader).size() == 4000);
+  }
+  
+  // A damaged index falls back to walking the blocks
+  corrupt(BINARY_PATH, static_cast<long>(size - 24 - 10));
+  {
+    TraceBinaryReader reader(BINARY_PATH);
+    assert(reader.isOpen() && !reader.indexed());
+    assert(reader.blockCount() == 5 && reader.recordCount() == 5000);
+  }
+  
+  // And a damaged header is not a trace at all
+  corrupt(BINARY_PATH, 20);
+  assert(!TraceBinaryReader(BINARY_PATH).isOpen());
+}
+
+TEST(hostile_count_is_rejected) {
+  TraceBinaryConfig config;
+  config.block_records = 1000;
+  std::vector<Event> events = makeTrace(500);
+  
+  // CRC-valid counts the payload cannot hold: never sized, never decoded
+  for (uint32_t count : {0xFFFFFFFFu, 0u}) {
+    writeTrace(events, config);
+    forgeCount(BINARY_PATH, count);
+    TraceBinaryReader reader(BINARY_PATH);
+    assert(reader.isOpen() && !reader.indexed());
+    assert(reader.blockCount() == 0 && reader.recordCount() == 0);
+    std::vector<Event> block(3);
+    assert(!reader.readBlock(0, block) && block.empty());
+  }
+  
+  // The largest count the payload could hold still gets past the bound,
+  // and fails in the decoder instead
+  writeTrace(events, config);
+  {
+    std::ifstream file(BINARY_PATH, std::ios::binary);
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    uint32_t payload = static_cast<uint32_t>(getLe(bytes, 48 + 8, 4));
+    file.close();
+    forgeCount(BINARY_PATH, payload / 7);
+  }
+  TraceBinaryReader reader(BINARY_PATH);
+  assert(reader.indexed() && reader.blockCount() == 1);
+  std::vector<Event> block;
+  assert(!reader.readBlock(0, block) && block.empty());
+}
+
+TEST(cut_short_file_keeps_whole_blocks) {
+  TraceBinaryConfig config;
+  config.block_records = 1000;
+  std::vector<Event> events = makeTrace(4500);
+  writeTrace(events, config);
+  
+  // Lose the index and half of the last block, as after a crash
+  size_t size;
+  {
+    TraceBinaryReader reader(BINARY_PATH);
+    size = reader.sizeBytes();
+  }
+  int result = truncate(BINARY_PATH, static_cast<off_t>(size - 24 - (8 + 5 * 20 + 4) - 500));
+  assert(result == 0);
+  (void)result;
+  
+  TraceBinaryReader reader(BINARY_PATH);
+  assert(reader.isOpen() && !reader.indexed());
+  assert(reader.blockCount() == 4);
+  std::vector<Event> decoded = readAll(reader);
+  assert(decoded.size() == 4000);
+  assert(closeEvent(decoded[3999], events[3999], reader.config()));
+}
+
+TEST(find_block_for_seek) {
+  TraceBinaryConfig config;
+  config.block_records = 1000;
+  std::vector<Event> events = makeTrace(10500);
+  writeTrace(events, config);
+  TraceBinaryReader reader(BINARY_PATH);
+  
+  assert(reader.findBlock(0.0) == 0);
+  assert(reader.findBlock(1e9) == reader.blockCount() - 1);
+  for (size_t i : {1, 999, 1000, 1001, 5500, 9999, 10499}) {
+    // A row starting a block may be reached from the block before it
+    size_t b = reader.findBlock(events[i].t_sec);
+    assert(b == i / 1000 || (i % 1000 == 0 && b == i / 1000 - 1));
+  }
+}
+
+TEST(csv_converter_round_trip) {
+  std::vector<Event> events = makeTrace(3000);
+  std::string text = csvText(events);
+  text += "not,a,row\n\n";
+  {
+    std::ofstream file(CSV_PATH, std::ios::binary);
+    file << text;
+  }
+  infrastructure::TraceConvertStats to_binary;
+  TraceBinaryConfig config;
+  bool ok = infrastructure::convertCsvToBinary(CSV_PATH, BINARY_PATH, config, to_binary);
+  assert(ok);
+  assert(to_binary.rows == 3000 && to_binary.skipped_rows == 1);
+  assert(to_binary.bytes_in == text.size() && to_binary.bytes_out < to_binary.bytes_in / 3);
+  assert(infrastructure::isBinaryTrace(BINARY_PATH));
+  assert(!infrastructure::isBinaryTrace(CSV_PATH));
+  
+  infrastructure::TraceConvertStats to_csv;
+  ok = infrastructure::convertBinaryToCsv(BINARY_PATH, CSV_BACK_PATH, to_csv);
+  assert(ok);
+  assert(to_csv.rows == 3000 && to_csv.bad_blocks == 0);
+  (void)ok;
+  
+  std::ifstream back(CSV_BACK_PATH);
+  std::string line;
+  std::getline(back, line);
+  assert(line == infrastructure::TRACE_CSV_HEADER);
+  size_t i = 0;
+  while (std::getline(back, line)) {
+    Event row;
+    bool parsed = infrastructure::parseTraceRow(line.data(), line.data() + line.size(), row);
+    assert(parsed && closeEvent(row, events[i], config));
+    (void)parsed;
+    ++i;
+  }
+  assert(i == events.size());
+  std::remove(CSV_PATH);
+  std::remove(CSV_BACK_PATH);
+}
+
+TEST(size_and_decode_speed_vs_csv) {
+  const size_t count = 400000;  // 100 s at 4 kHz
+  std::vector<Event> events = makeTrace(count);
+  std::string text = csvText(events);
+  writeTrace(events, TraceBinaryConfig());
+  TraceBinaryReader reader(BINARY_PATH);
+  
+  // CSV: split lines and parse in place, as ReplaySensorProvider does
+  auto start = std::chrono::steady_clock::now();
+  const char* p = text.data() + text.find('\n') + 1;
+  const char* end = text.data() + text.size();
+  size_t parsed = 0;
+  double checksum_csv = 0.0;
+  while (p < end) {
+    const char* eol = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+    Event row;
+    if (infrastructure::parseTraceRow(p, eol, row)) {
+      ++parsed;
+      checksum_csv += row.frame.az;
+    }
+    p = eol + 1;
+  }
+  double csv_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  
+  start = std::chrono::steady_clock::now();
+  size_t decoded = 0;
+  double checksum_binary = 0.0;
+  std::vector<Event> block;
+  for (size_t b = 0; b < reader.blockCount(); ++b) {
+    reader.readBlock(b, block);
+    decoded += block.size();
+    for (const Event& row : block) {
+      checksum_binary += row.frame.az;
+    }
+  }
+  double binary_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  
+  assert(parsed == count && decoded == count);
+  assert(std::fabs(checksum_csv - checksum_binary) < count * 1e-4);
+  double ratio = static_cast<double>(text.size()) / static_cast<double>(reader.sizeBytes());
+  assert(ratio > 3.0);
+  std::cout << "  " << count << " rows: CSV " << text.size() / 1e6 << " MB ("
+            << static_cast<double>(text.size()) / count << " B/row), binary "
+            << reader.sizeBytes() / 1e6 << " MB (" << static_cast<double>(reader.sizeBytes()) / count
+            << " B/row), " << ratio << "x smaller" << std::endl;
+  std::cout << "  decode: CSV " << count / csv_sec / 1e6 << " M rows/s, binary "
+            << count / binary_sec / 1e6 << " M rows/s (" << csv_sec / binary_sec << "x)" << std::endl;
+  std::remove(BINARY_PATH);
+}
+
+int main() {
+  std::cout << "=== Binary Trace Tests ===" << std::endl;
+  
+  RUN_TEST(round_trip_within_half_a_step);
+  RUN_TEST(awkward_values);
+  RUN_TEST(corruption_is_detected);
+  RUN_TEST(hostile_count_is_rejected);
+  RUN_TEST(cut_short_file_keeps_whole_blocks);
+  RUN_TEST(find_block_for_seek);
+  RUN_TEST(csv_converter_round_trip);
+  RUN_TEST(size_and_decode_speed_vs_csv);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,238 @@
+#include "infrastructure/TraceRecorder.hpp"
+#include "infrastructure/ReplaySensorProvider.hpp"
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+using infrastructure::Event;
+using infrastructure::SensorFrame;
+using infrastructure::TraceRecorder;
+using infrastructure::TraceRecorderConfig;
+
+namespace {
+
+const char* TRACE_PATH = "test_trace_recorder.csv";
+
+// Awkward values: negative, tiny, large, long decimal expansions
+struct Lcg {
+  uint32_t state = 12345u;
+  float next() {
+    state = state * 1664525u + 1013904223u;
+    float unit = static_cast<float>(state >> 8) / 16777216.0f * 2.0f - 1.0f;
+    switch (state & 3u) {
+      case 0: return unit * 1e-6f;
+      case 1: return unit * 1e4f;
+      default: return unit * 20.0f;
+    }
+  }
+};
+
+SensorFrame makeFrame(Lcg& rng, double t) {
+  return SensorFrame(t, rng.next(), rng.next(), rng.next(), rng.next(), rng.next(), rng.next());
+}
+
+bool sameEvent(const Event& a, const Event& b) {
+  const SensorFrame& f = a.frame;
+  const SensorFrame& g = b.frame;
+  return a.type == b.type && a.t_sec == b.t_sec && f.t_sec == g.t_sec
+      && f.ax == g.ax && f.ay == g.ay && f.az == g.az && f.gx == g.gx && f.gy == g.gy && f.gz == g.gz;
+}
+
+std::vector<Event> readTrace(const std::string& path) {
+  std::ifstream file(path);
+  std::string line;
+  std::getline(file, line);
+  assert(line == infrastructure::TRACE_CSV_HEADER);
+  std::vector<Event> rows;
+  while (std::getline(file, line)) {
+    Event row;
+    bool ok = infrastructure::parseTraceRow(line.data(), line.data() + line.size(), row);
+    assert(ok);
+    (void)ok;
+    rows.push_back(row);
+  }
+  return rows;
+}
+
+} // namespace
+
+TEST(round_trip_is_exact) {
+  std::vector<Event> expected;
+  {
+    // Chunks larger than a buffer: each fills one buffer and hands it off,
+    // then flush() writes the rest, so nothing is dropped
+    TraceRecorderConfig config;
+    config.buffer_records = 1500;
+    TraceRecorder recorder(TRACE_PATH, config);
+    assert(recorder.isOpen());
+    recorder.start();
+    
+    Lcg rng;
+    double t = 1234.5678;  // Monotonic clock values are large
+    for (int i = 0; i < 20000; ++i) {
+      t += 0.000250001;
+      if (i % 500 == 499) {
+        Event event;
+        event.type = i % 1000 == 999 ? Event::Type::Impact : Event::Type::SwingStart;
+        event.t_sec = t;
+        event.frame = makeFrame(rng, t);
+        bool ok = recorder.record(event);
+        assert(ok);
+        (void)ok;
+        expected.push_back(event);
+      } else {
+        SensorFrame frame = makeFrame(rng, t);
+        bool ok = recorder.record(frame);
+        assert(ok);
+        (void)ok;
+        Event pose;
+        pose.t_sec = t;
+        pose.frame = frame;
+        expected.push_back(pose);
+      }
+      if (i % 2500 == 2499) {
+        recorder.flush();
+      }
+    }
+    recorder.stop();
+    
+    infrastructure::TraceRecorderStats s = recorder.stats();
+    assert(s.recorded == expected.size());
+    assert(s.written == expected.size());
+    assert(s.dropped == 0 && s.backpressure == 0 && !s.write_error);
+    assert(s.flushes == 16);
+    std::cout << "  " << s.written << " records, " << s.bytes_written << " bytes in "
+              << s.flushes << " writes" << std::endl;
+  }
+  
+  std::vector<Event> rows = readTrace(TRACE_PATH);
+  assert(rows.size() == expected.size());
+  for (size_t i = 0; i < rows.size(); ++i) {
+    assert(sameEvent(rows[i], expected[i]));
+  }
+  
+  // Replay sees the same frames and skips the detector rows
+  infrastructure::ReplaySensorProvider replay(TRACE_PATH, infrastructure::ReplaySensorProvider::Mode::Fast);
+  SensorFrame frame;
+  size_t next = 0;
+  while (replay.poll(frame)) {
+    while (expected[next].type != Event::Type::Pose) {
+      ++next;
+    }
+    Event pose;
+    pose.t_sec = frame.t_sec;
+    pose.frame = frame;
+    assert(sameEvent(pose, expected[next]));
+    ++next;
+  }
+  assert(replay.corruptRows() == 0);
+  assert(replay.annotationRows() == 40);
+  assert(replay.framesDelivered() == expected.size() - 40);
+}
+
+TEST(full_buffers_drop_instead_of_blocking) {
+  // No writer thread yet: the first buffer is handed off and never freed
+  TraceRecorderConfig config;
+  config.buffer_records = 4;
+  TraceRecorder recorder(TRACE_PATH, config);
+  Lcg rng;
+  int accepted = 0;
+  for (int i = 0; i < 20; ++i) {
+    accepted += recorder.record(makeFrame(rng, i)) ? 1 : 0;
+  }
+  infrastructure::TraceRecorderStats s = recorder.stats();
+  assert(accepted == 8);
+  assert(s.recorded == 8 && s.dropped == 12 && s.backpressure == 1);
+  assert(s.written == 0);
+  
+  // Once the writer catches up recording resumes
+  recorder.start();
+  recorder.flush();
+  for (int i = 20; i < 24; ++i) {
+    accepted += recorder.record(makeFrame(rng, i)) ? 1 : 0;
+  }
+  assert(accepted == 12);
+  recorder.stop();
+  s = recorder.stats();
+  assert(s.written == 12 && s.dropped == 12 && s.backpressure == 1);
+  
+  std::vector<Event> rows = readTrace(TRACE_PATH);
+  assert(rows.size() == 12);
+  assert(rows[7].t_sec == 7.0 && rows[8].t_sec == 20.0 && rows[11].t_sec == 23.0);
+}
+
+TEST(writes_without_thread_on_stop) {
+  TraceRecorderConfig config;
+  config.buffer_records = 16;
+  {
+    TraceRecorder recorder(TRACE_PATH, config);
+    Lcg rng;
+    for (int i = 0; i < 10; ++i) {
+      recorder.record(makeFrame(rng, i));
+    }
+  }  // Destructor writes on this thread
+  assert(readTrace(TRACE_PATH).size() == 10);
+  
+  TraceRecorder unwritable("does/not/exist/trace.csv");
+  assert(!unwritable.isOpen());
+  Lcg rng;
+  unwritable.record(makeFrame(rng, 0.0));
+  unwritable.stop();
+  assert(unwritable.stats().written == 0);
+}
+
+TEST(record_cost) {
+  const int count = 1000000;
+  TraceRecorder recorder(TRACE_PATH);
+  recorder.start();
+  
+  Lcg rng;
+  std::vector<SensorFrame> frames;
+  for (int i = 0; i < 4096; ++i) {
+    frames.push_back(makeFrame(rng, i * 0.00025));
+  }
+  double worst_us = 0.0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; ++i) {
+    auto before = std::chrono::steady_clock::now();
+    recorder.record(frames[i & 4095]);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - before).count();
+    worst_us = std::max(worst_us, us);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  recorder.stop();
+  
+  infrastructure::TraceRecorderStats s = recorder.stats();
+  assert(s.written + s.dropped == static_cast<uint64_t>(count));
+  assert(s.recorded == s.written);
+  std::cout << "  " << count / seconds / 1e6 << " M records/s offered (timing included), worst record() "
+            << worst_us << " us, " << s.dropped << " dropped in " << s.backpressure
+            << " stalls, " << s.bytes_written / 1e6 << " MB written" << std::endl;
+  std::remove(TRACE_PATH);
+}
+
+int main() {
+  std::cout << "=== Trace Recorder Tests ===" << std::endl;
+  
+  RUN_TEST(round_trip_is_exact);
+  RUN_TEST(full_buffers_drop_instead_of_blocking);
+  RUN_TEST(writes_without_thread_on_stop);
+  RUN_TEST(record_cost);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
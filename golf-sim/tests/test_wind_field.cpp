@@ -0,0 +1,243 @@
+#include "domain/WindField.hpp"
+#include "domain/PhysicsEngine.hpp"
+#include "infrastructure/FileCourseRepository.hpp"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Simple test framework (same as test_physics)
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+  std::cout << "Running " #name "..." << std::endl; \
+  test_##name(); \
+  std::cout << "  PASSED" << std::endl; \
+} while(0)
+
+namespace {
+
+domain::WindFieldConfig breeze(double speed, double direction_deg, uint64_t seed = 7) {
+  domain::WindFieldConfig config;
+  config.speed_mps = speed;
+  config.direction_deg = direction_deg;
+  config.seed = seed;
+  return config;
+}
+
+domain::PhysicsConfig spinAwareConfig() {
+  domain::PhysicsConfig config;
+  config.aero_model = domain::PhysicsConfig::AeroModel::SpinAware;
+  config.integrator = domain::PhysicsConfig::Integrator::RK4;
+  return config;
+}
+
+domain::LaunchCondition drive() {
+  domain::LaunchCondition launch(70.0, 12.0);
+  launch.initial_spin = domain::Vec3(2800.0, 0.0, 0.0);  // Backspin
+  return launch;
+}
+
+domain::ShotResult fly(const domain::PhysicsConfig& config, const domain::WindField* field,
+                       double time_offset = 0.0) {
+  domain::PhysicsEngine physics(config);
+  physics.setWindField(field, time_offset);
+  physics.startShot(drive());
+  while (!physics.isAtRest()) {
+    physics.step(1.0 / 60.0);
+  }
+  return physics.calculateResult();
+}
+
+} // namespace
+
+TEST(log_profile) {
+  domain::WindField field(breeze(5.0, 90.0));
+  const domain::WindFieldConfig& c = field.config();
+  
+  assert(field.profileFactor(0.0) == 0.0);
+  assert(field.profileFactor(-1.0) == 0.0);
+  assert(std::abs(field.profileFactor(c.reference_height_m) - 1.0) < 1e-12);
+  double expected = std::log(1.0 + 2.0 / c.roughness_length_m)
+                  / std::log(1.0 + c.reference_height_m / c.roughness_length_m);
+  assert(std::abs(field.profileFactor(2.0) - expected) < 1e-12);
+  for (double z = 1.0; z < 60.0; z += 1.0) {
+    assert(field.profileFactor(z + 1.0) > field.profileFactor(z));
+  }
+  
+  // Tailwind along +y at the reference height
+  domain::Vec3 mean = field.meanWind(10.0);
+  assert(std::abs(mean.y - 5.0) < 1e-12 && std::abs(mean.x) < 1e-12);
+}
+
+TEST(calm_field_is_zero) {
+  domain::WindField field(breeze(0.0, 45.0));
+  for (double t = 0.0; t < 40.0; t += 1.3) {
+    domain::Vec3 w = field.sample(domain::Vec3(3.0, 120.0, 25.0), t);
+    assert(w.x == 0.0 && w.y == 0.0 && w.z == 0.0);
+  }
+}
+
+TEST(deterministic_per_seed) {
+  domain::WindField a(breeze(6.0, 200.0, 11));
+  domain::WindField b(breeze(6.0, 200.0, 11));
+  domain::WindField c(breeze(6.0, 200.0, 12));
+  bool differs = false;
+  for (double t = 0.0; t < 30.0; t += 0.37) {
+    domain::Vec3 pos(0.0, t * 9.0, 0.5 * t);
+    domain::Vec3 wa = a.sample(pos, t);
+    domain::Vec3 wb = b.sample(pos, t);
+    domain::Vec3 wc = c.sample(pos, t);
+    assert(wa.x == wb.x && wa.y == wb.y);
+    differs = differs || wa.x != wc.x || wa.y != wc.y;
+  }
+  assert(differs);
+}
+
+TEST(trilinear_between_nodes) {
+  domain::WindField field(breeze(8.0, 120.0));
+  const domain::WindFieldConfig& c = field.config();
+  
+  // Midpoints of grid edges are the averages of the two nodes
+  double z = 10.0;
+  double y = 60.0;
+  double t = 3.0;
+  domain::Vec3 node = field.sample(domain::Vec3(0.0, y, z), t);
+  domain::Vec3 up = field.sample(domain::Vec3(0.0, y, z + c.height_step_m), t);
+  domain::Vec3 mid = field.sample(domain::Vec3(0.0, y, z + 0.5 * c.height_step_m), t);
+  assert(std::abs(mid.x - 0.5 * (node.x + up.x)) < 1e-9);
+  domain::Vec3 later = field.sample(domain::Vec3(0.0, y, z), t + c.time_step_sec);
+  domain::Vec3 between = field.sample(domain::Vec3(0.0, y, z), t + 0.5 * c.time_step_sec);
+  assert(std::abs(between.y - 0.5 * (node.y + later.y)) < 1e-9);
+  
+  // Uniform across the fairway; clamped above the grid; still at the ground
+  domain::Vec3 side = field.sample(domain::Vec3(25.0, y, z), t);
+  assert(side.x == node.x && side.y == node.y);
+  domain::Vec3 top = field.sample(domain::Vec3(0.0, y, c.max_height_m), t);
+  domain::Vec3 above = field.sample(domain::Vec3(0.0, y, c.max_height_m + 50.0), t);
+  assert(top.x == above.x && top.y == above.y);
+  domain::Vec3 ground = field.sample(domain::Vec3(0.0, y, -1.0), t);
+  assert(ground.x == 0.0 && ground.y == 0.0);
+  
+  // Time wraps continuously
+  domain::Vec3 wrapped = field.sample(domain::Vec3(0.0, y, z), t + c.duration_sec);
+  assert(std::abs(wrapped.x - node.x) < 1e-9 && std::abs(wrapped.y - node.y) < 1e-9);
+}
+
+TEST(gusts_around_the_mean) {
+  domain::WindFieldConfig config = breeze(6.0, 90.0);
+  domain::WindField field(config);
+  domain::Vec3 mean = field.meanWind(20.0);
+  
+  double sum = 0.0;
+  double sum_sq = 0.0;
+  int n = 0;
+  double max_step = 0.0;
+  double prev = field.sample(domain::Vec3(0.0, 0.0, 20.0), 0.0).y;
+  for (double t = 0.0; t < config.duration_sec; t += 0.05) {
+    double w = field.sample(domain::Vec3(0.0, 0.0, 20.0), t).y;
+    sum += w;
+    sum_sq += w * w;
+    max_step = std::max(max_step, std::abs(w - prev));
+    prev = w;
+    ++n;
+  }
+  double avg = sum / n;
+  double sd = std::sqrt(sum_sq / n - avg * avg);
+  std::cout << "  mean " << avg << " m/s (profile " << mean.y << "), gust sd " << sd << std::endl;
+  assert(std::abs(avg - mean.y) < 0.35 * config.gust_intensity * mean.y * 3.0);
+  assert(sd > 0.1 * config.gust_intensity * mean.y && sd < 2.0 * config.gust_intensity * mean.y);
+  assert(max_step < 0.5);  // Smooth in time: no jumps between samples
+  
+  // Gusts travel downwind: the series at y = 100 m trails the tee's
+  double lag = 100.0 / config.speed_mps;
+  double tee = field.sample(domain::Vec3(0.0, 0.0, 20.0), 5.0).y;
+  double downwind = field.sample(domain::Vec3(0.0, 100.0, 20.0), 5.0 + lag).y;
+  assert(std::abs(tee - downwind) < 0.2);
+}
+
+TEST(engine_calm_field_matches_constant_wind) {
+  domain::PhysicsConfig config = spinAwareConfig();
+  config.wind_velocity = domain::Vec3(1.5, -2.0, 0.0);
+  domain::WindField calm(breeze(0.0, 0.0));
+  
+  domain::ShotResult without = fly(config, nullptr);
+  domain::ShotResult with = fly(config, &calm);
+  assert(without.carry_m == with.carry_m);
+  assert(without.lateral_m == with.lateral_m);
+  assert(without.flight_time_s == with.flight_time_s);
+}
+
+TEST(engine_feels_field) {
+  domain::PhysicsConfig config = spinAwareConfig();
+  domain::WindField tail(breeze(6.0, 90.0));
+  domain::WindField head(breeze(6.0, 270.0));
+  domain::WindField cross(breeze(6.0, 0.0));
+  
+  domain::ShotResult still = fly(config, nullptr);
+  domain::ShotResult with_tail = fly(config, &tail);
+  domain::ShotResult with_head = fly(config, &head);
+  domain::ShotResult with_cross = fly(config, &cross);
+  std::cout << "  carry still " << still.carry_m << " tail " << with_tail.carry_m
+            << " head " << with_head.carry_m << " cross lateral " << with_cross.lateral_m << std::endl;
+  assert(with_tail.carry_m > still.carry_m + 2.0);
+  assert(with_head.carry_m < still.carry_m - 2.0);
+  assert(with_cross.lateral_m > 2.0);  // Blown toward +x
+  
+  // Same field and offset: same shot; another offset meets other gusts
+  domain::ShotResult again = fly(config, &tail);
+  assert(again.carry_m == with_tail.carry_m);
+  domain::ShotResult later = fly(config, &tail, 11.0);
+  assert(later.carry_m != with_tail.carry_m);
+}
+
+TEST(course_repository_reads_wind) {
+  const char* path = "test_wind_course.csv";
+  {
+    std::ofstream out(path);
+    out << "# hole,par,distance_m,wind_mps,wind_dir_deg\n";
+    out << "1,4,350,4.5,135\n";
+    out << "2,3,150\n";
+  }
+  infrastructure::FileCourseRepository repo(path);
+  application::CourseInfo windy = repo.loadHole(1);
+  assert(windy.pin_distance_m == 350.0);
+  assert(windy.wind_speed_mps == 4.5 && windy.wind_direction_deg == 135.0);
+  application::CourseInfo calm = repo.loadHole(2);
+  assert(calm.par == 3 && calm.wind_speed_mps == 0.0);
+  std::remove(path);
+}
+
+TEST(sample_timing) {
+  domain::WindField field(breeze(6.0, 120.0));
+  const int n = 1000000;
+  double acc = 0.0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; ++i) {
+    double t = i * (1.0 / 240.0);
+    acc += field.sample(domain::Vec3(0.0, std::fmod(t * 40.0, 300.0), std::fmod(t * 3.0, 40.0)), t).y;
+  }
+  double ns = std::chrono::duration<double, std::nano>(
+    std::chrono::steady_clock::now() - start).count() / n;
+  std::cout << "  " << ns << " ns per sample, " << field.nodeCount() << " nodes (checksum "
+            << acc << ")" << std::endl;
+}
+
+int main() {
+  std::cout << "=== Wind Field Tests ===" << std::endl;
+  
+  RUN_TEST(log_profile);
+  RUN_TEST(calm_field_is_zero);
+  RUN_TEST(deterministic_per_seed);
+  RUN_TEST(trilinear_between_nodes);
+  RUN_TEST(gusts_around_the_mean);
+  RUN_TEST(engine_calm_field_matches_constant_wind);
+  RUN_TEST(engine_feels_field);
+  RUN_TEST(course_repository_reads_wind);
+  RUN_TEST(sample_timing);
+  
+  std::cout << "\nAll tests passed!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,47 @@
+#include "infrastructure/TraceBinary.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// Converts a sensor trace between CSV (t,type,ax,ay,az,gx,gy,gz) and the
+// binary format; the direction follows the input file.
+//
+//   trace-convert [--block N] <input> <output>
+int main(int argc, char** argv) {
+  infrastructure::TraceBinaryConfig config;
+  int arg = 1;
+  if (argc == 5 && std::strcmp(argv[1], "--block") == 0) {
+    config.block_records = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    arg = 3;
+  }
+  if (argc - arg != 2) {
+    std::cerr << "usage: " << argv[0] << " [--block N] <input> <output>" << std::endl;
+    return 2;
+  }
+  std::string input = argv[arg];
+  std::string output = argv[arg + 1];
+  
+  infrastructure::TraceConvertStats stats;
+  bool to_csv = infrastructure::isBinaryTrace(input);
+  bool ok = to_csv ? infrastructure::convertBinaryToCsv(input, output, stats)
+                   : infrastructure::convertCsvToBinary(input, output, config, stats);
+  if (!ok) {
+    std::cerr << "[Error] Conversion failed: " << input << " -> " << output << std::endl;
+    return 1;
+  }
+  
+  std::cout << "[Convert] " << (to_csv ? "binary -> CSV: " : "CSV -> binary: ") << stats.rows << " rows, "
+            << stats.bytes_in << " -> " << stats.bytes_out << " bytes";
+  if (stats.bytes_out > 0) {
+    std::cout << " (x" << static_cast<double>(stats.bytes_in) / static_cast<double>(stats.bytes_out) << ")";
+  }
+  if (stats.skipped_rows > 0) {
+    std::cout << ", " << stats.skipped_rows << " rows skipped";
+  }
+  if (stats.bad_blocks > 0) {
+    std::cout << ", " << stats.bad_blocks << " corrupt blocks skipped";
+  }
+  std::cout << std::endl;
+  return 0;
+}